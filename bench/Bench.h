@@ -0,0 +1,100 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Minimal host-side benchmark registry, the counterpart of tests/Test.h. Each BENCH registers
+// itself at static initialisation; Measure times a body and keeps the result for the JSON report.
+namespace Bench
+{
+    // Catalogue sizes every scaling case is run at.
+    inline constexpr std::array<std::size_t, 4> Sizes{ 100, 1000, 10000, 100000 };
+
+    struct Case
+    {
+        std::string_view name;
+        std::function<void()> body;
+    };
+
+    struct Result
+    {
+        std::string name;
+        std::size_t size;
+        std::uint64_t operations;
+        double nanoseconds;
+        double allocations;
+        std::vector<std::pair<std::string, double>> counters;
+    };
+
+    inline auto GetCases() -> std::vector<Case>&
+    {
+        static std::vector<Case> cases;
+        return cases;
+    }
+
+    inline auto GetResults() -> std::vector<Result>&
+    {
+        static std::vector<Result> results;
+        return results;
+    }
+
+    struct Registrar
+    {
+        Registrar(std::string_view a_name, std::function<void()> a_body) { GetCases().push_back({ a_name, std::move(a_body) }); }
+    };
+
+    // Heap allocations so far; Main.cpp replaces the global operator new to count them.
+    inline std::atomic<std::uint64_t> Allocations{ 0 };
+
+    // Keeps a computed value observable so the optimiser cannot drop the work that produced it.
+    inline void Consume(std::uint64_t a_value)
+    {
+        static volatile std::uint64_t sink;
+        sink = sink + a_value;
+    }
+
+    // Calls a_body, which performs a_operations operations per call, until at least 100 ms have
+    // passed, and records the mean time and heap allocations of one operation. Returns the result
+    // so callers can add counters.
+    template <class F>
+    auto Measure(std::string a_name, std::size_t a_size, std::uint64_t a_operations, F&& a_body) -> Result&
+    {
+        using Clock = std::chrono::steady_clock;
+
+        a_body();
+
+        std::uint64_t iterations = 0;
+        const auto allocations = Allocations.load(std::memory_order_relaxed);
+        const auto start = Clock::now();
+        auto elapsed = Clock::duration::zero();
+
+        do {
+            a_body();
+            iterations++;
+            elapsed = Clock::now() - start;
+        } while (elapsed < std::chrono::milliseconds(100));
+
+        const auto operations = static_cast<double>(iterations * a_operations);
+        const auto nanoseconds = std::chrono::duration<double, std::nano>(elapsed).count() / operations;
+        const auto allocated = static_cast<double>(Allocations.load(std::memory_order_relaxed) - allocations) / operations;
+
+        std::fprintf(stderr, "%-40s %8zu %14.1f ns/op %12.1f allocs/op\n", a_name.c_str(), a_size, nanoseconds, allocated);
+        return GetResults().emplace_back(std::move(a_name), a_size, iterations * a_operations, nanoseconds, allocated);
+    }
+}
+
+#define BENCH_CONCAT_IMPL(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT_IMPL(a, b)
+
+#define BENCH(name)                                                                                     \
+    static void BENCH_CONCAT(Bench_, name)();                                                           \
+    static const Bench::Registrar BENCH_CONCAT(Registrar_, name){ #name, &BENCH_CONCAT(Bench_, name) }; \
+    static void BENCH_CONCAT(Bench_, name)()
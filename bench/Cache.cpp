@@ -0,0 +1,36 @@
+#include "Bench.h"
+#include "Cache.h"
+#include "Fixture.h"
+#include "Json.h"
+
+#include <sstream>
+
+// Config::Load's cache path: decode Catalogue.bin from memory and group the quests by file. Compare
+// with ConfigParse at the same size for what the cache saves on a warm start.
+BENCH(CacheLoad)
+{
+    for (const auto size : Bench::Sizes) {
+        const std::vector<Cache::Source> sources{ { "C:/Data/Quests/Bench.json", size, 0, 0 } };
+
+        std::istringstream stream(Fixture::MakeQuestsJson(size));
+        Cache::Quests quests;
+        for (auto& quest : Json::ReadEntries<Entries::Quest>(stream, "Quests", Entries::ReadQuest)) {
+            quest.file = sources.front().path;
+            quests[quest.file].push_back(std::move(quest));
+        }
+
+        Binary::Writer writer;
+        Cache::Encode(writer, sources, quests, {}, {}, {});
+
+        std::vector<Entries::Reward> rewards;
+        std::vector<Entries::Tracker> trackers;
+        std::vector<Entries::Text> texts;
+
+        auto& result = Bench::Measure("CacheLoad", size, 1, [&]() {
+            Binary::Reader reader(writer.GetData());
+            Bench::Consume(Cache::Decode(reader, sources, quests, rewards, trackers, texts) ? quests.size() : 0);
+        });
+
+        result.counters.emplace_back("bytes", static_cast<double>(writer.GetData().size()));
+    }
+}
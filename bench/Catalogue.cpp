@@ -0,0 +1,130 @@
+#include "Bench.h"
+#include "Fixture.h"
+#include "Store.h"
+
+#include <unordered_map>
+
+namespace
+{
+    struct Tracker
+    {
+        Fixture::Location* region;
+    };
+}
+
+// Finding one region's quests of one type through the index, against the linear filter over every
+// quest that System used before it. The indexed cost should stay flat up to 10k quests and beyond.
+BENCH(RegionTypeQuery)
+{
+    for (const auto size : Bench::Sizes) {
+        Fixture::World world(size);
+
+        std::uint64_t found = 0;
+        Bench::Measure("RegionTypeQuery/Index", size, Fixture::HoldCount * Fixture::TypeCount, [&]() {
+            for (auto& hold : world.holds) {
+                for (std::size_t type = 1; type <= Fixture::TypeCount; type++) {
+                    found += world.catalogue.GetQuests(&hold, static_cast<Tables::TYPE>(type)).size();
+                }
+            }
+        });
+
+        Bench::Measure("RegionTypeQuery/Scan", size, Fixture::HoldCount * Fixture::TypeCount, [&]() {
+            for (auto& hold : world.holds) {
+                for (std::size_t type = 1; type <= Fixture::TypeCount; type++) {
+                    for (const auto& quest : world.catalogue.GetQuests()) {
+                        found += quest->region == &hold && quest->type == static_cast<Tables::TYPE>(type) ? 1 : 0;
+                    }
+                }
+            }
+        });
+
+        Bench::Consume(found);
+    }
+}
+
+// What System::PopulateMenu does per ShowMenu call: walk the region's list for one type and skip
+// reserved locations. Every tenth location is reserved.
+BENCH(MenuPopulation)
+{
+    for (const auto size : Bench::Sizes) {
+        Fixture::World world(size);
+
+        Store::Reservations<Fixture::Location> reservations;
+        for (std::size_t i = 0; i < world.locations.size(); i += 10) {
+            reservations.Insert(&world.locations[i]);
+        }
+
+        std::size_t next = 0;
+        Bench::Measure("MenuPopulation", size, Fixture::HoldCount * Fixture::TypeCount, [&]() {
+            for (auto& hold : world.holds) {
+                for (std::size_t type = 1; type <= Fixture::TypeCount; type++) {
+                    for (const auto& quest : world.catalogue.GetQuests(&hold, static_cast<Tables::TYPE>(type))) {
+                        next += reservations.Contains(quest->location) ? 0 : 1;
+                    }
+                }
+            }
+        });
+
+        Bench::Consume(next);
+    }
+}
+
+// The container sink's lookup: System::notes maps a picked-up note's FormID to its quest. Half
+// of the probes miss, like items that are not notes.
+BENCH(ContainerLookup)
+{
+    for (const auto size : Bench::Sizes) {
+        Fixture::World world(size);
+
+        std::unordered_map<std::uint32_t, std::shared_ptr<Fixture::Quest>> notes;
+        for (std::size_t i = 0; i < world.quests.size(); i++) {
+            notes.try_emplace(static_cast<std::uint32_t>(0xFF000000 + i), world.quests[i]);
+        }
+
+        Random::PCG32 random;
+        std::vector<std::uint32_t> probes(1024);
+        for (auto& probe : probes) {
+            probe = static_cast<std::uint32_t>(0xFF000000 + random.Next(static_cast<std::uint32_t>(size * 2)));
+        }
+
+        std::uint64_t found = 0;
+        Bench::Measure("ContainerLookup", size, probes.size(), [&]() {
+            for (const auto probe : probes) {
+                const auto it = notes.find(probe);
+                found += it != notes.end() && it->second->location ? 1 : 0;
+            }
+        });
+
+        Bench::Consume(found);
+    }
+}
+
+// TESActorLocationChangeEvent: the region type mask for the availability globals and the tracked
+// region for the location alias, both through their per-location caches.
+BENCH(LocationChange)
+{
+    for (const auto size : Bench::Sizes) {
+        Fixture::World world(size);
+
+        Store::Trackers<Tracker> trackers;
+        for (auto& hold : world.holds) {
+            trackers.Add(std::make_shared<Tracker>(&hold));
+        }
+
+        Random::PCG32 random;
+        std::vector<Fixture::Location*> probes(1024);
+        for (auto& probe : probes) {
+            probe = &world.locations[random.Next(static_cast<std::uint32_t>(world.locations.size()))];
+        }
+
+        std::uint64_t mask = 0;
+        Bench::Measure("LocationChange", size, probes.size(), [&]() {
+            for (const auto probe : probes) {
+                mask += world.catalogue.GetLocationMask(probe);
+                mask += trackers.FindRegion(probe) ? 1 : 0;
+            }
+        });
+
+        Bench::Consume(mask);
+    }
+}
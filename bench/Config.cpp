@@ -0,0 +1,65 @@
+#include "Bench.h"
+#include "Fixture.h"
+#include "Json.h"
+
+#include <jsoncons/json.hpp>
+
+#include <sstream>
+
+// Config::ReadQuests on one quest pack of a_size entries, from memory so disk speed stays out of it.
+BENCH(ConfigParse)
+{
+    for (const auto size : Bench::Sizes) {
+        const auto text = Fixture::MakeQuestsJson(size);
+
+        std::size_t parsed = 0;
+        auto& result = Bench::Measure("ConfigParse", size, 1, [&]() {
+            std::istringstream stream(text);
+            auto quests = Json::ReadEntries<Entries::Quest>(stream, "Quests", Entries::ReadQuest);
+            std::erase_if(quests, [](const Entries::Quest& a_quest) { return !Entries::IsValid(a_quest); });
+            parsed = quests.size();
+        });
+
+        result.counters.emplace_back("entries", static_cast<double>(parsed));
+        result.counters.emplace_back("mb_per_second", static_cast<double>(text.size()) / result.nanoseconds * 1e3);
+    }
+}
+
+// The streaming reader against the DOM path Config replaced, on one 50k-entry quest pack: parse the
+// whole document, then read the same fields out of it with the same conversions.
+BENCH(ConfigParseCursorVsDom)
+{
+    constexpr std::size_t size{ 50000 };
+    const auto text = Fixture::MakeQuestsJson(size);
+
+    auto& cursor = Bench::Measure("ConfigParse/Cursor", size, size, [&]() {
+        std::istringstream stream(text);
+        auto quests = Json::ReadEntries<Entries::Quest>(stream, "Quests", Entries::ReadQuest);
+        std::erase_if(quests, [](const Entries::Quest& a_quest) { return !Entries::IsValid(a_quest); });
+        Bench::Consume(quests.size());
+    });
+    cursor.counters.emplace_back("mb_per_second", static_cast<double>(text.size()) / (cursor.nanoseconds * size) * 1e3);
+
+    const auto readForm = [](const jsoncons::json& a_form) -> Entries::Form {
+        return { Entries::ToInteger<std::uint32_t>(a_form.at("FormID").as<std::string>()), a_form.at("ModName").as<std::string>() };
+    };
+
+    auto& dom = Bench::Measure("ConfigParse/Dom", size, size, [&]() {
+        std::istringstream stream(text);
+        const auto document = jsoncons::json::parse(stream);
+
+        std::vector<Entries::Quest> quests;
+        for (const auto& element : document.at("Quests").array_range()) {
+            auto& quest = quests.emplace_back();
+            quest.name = element.at("LocationName").as<std::string>();
+            quest.difficulty = element.at("Difficulty").as<std::string>();
+            quest.type = element.at("Type").as<std::string>();
+            quest.location = readForm(element.at("Location"));
+            quest.region = readForm(element.at("Region"));
+            quest.quest = readForm(element.at("Quest"));
+        }
+        std::erase_if(quests, [](const Entries::Quest& a_quest) { return !Entries::IsValid(a_quest); });
+        Bench::Consume(quests.size());
+    });
+    dom.counters.emplace_back("mb_per_second", static_cast<double>(text.size()) / (dom.nanoseconds * size) * 1e3);
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Catalogue.h"
+#include "Random.h"
+#include "Tables.h"
+
+#include <charconv>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Synthetic catalogues shaped like a large quest pack: a handful of holds, one location per
+// quest inside them, and a small pool of owning quests shared by type and difficulty.
+namespace Fixture
+{
+    // Stand-ins for BGSLocation / TESQuest and System::Quest with only what the headers read.
+    struct Location
+    {
+        Location* parentLoc;
+        std::uint32_t formID;
+    };
+
+    struct Objective
+    {
+        std::uint16_t index;
+        std::string displayText;
+    };
+
+    struct Owner
+    {
+        std::uint32_t formID;
+        std::vector<Objective> objectives;
+    };
+
+    struct Quest
+    {
+        Owner* quest;
+        Location* location;
+        Location* region;
+        Tables::TYPE type;
+        Tables::DIFFICULTY difficulty;
+        std::string name;
+        std::uint16_t objectiveIndex{ 0 };
+    };
+
+    inline constexpr std::size_t HoldCount{ 9 };
+    inline constexpr std::size_t TypeCount{ 11 };
+    inline constexpr std::size_t DifficultyCount{ 6 };
+    inline constexpr std::size_t ObjectiveCount{ 128 };
+
+    struct World
+    {
+        explicit World(std::size_t a_size)
+        {
+            Random::PCG32 random;
+            random.Seed(a_size);
+
+            for (std::size_t i = 0; i < HoldCount; i++) {
+                holds.push_back({ nullptr, static_cast<std::uint32_t>(0x100 + i) });
+            }
+
+            for (std::size_t i = 0; i < TypeCount * DifficultyCount; i++) {
+                auto& owner = owners.emplace_back(static_cast<std::uint32_t>(0x800 + i));
+                for (std::size_t j = 0; j < ObjectiveCount; j++) {
+                    owner.objectives.emplace_back(static_cast<std::uint16_t>(j));
+                }
+            }
+
+            for (std::size_t i = 0; i < a_size; i++) {
+                auto& hold = holds[random.Next(HoldCount)];
+                auto& location = locations.emplace_back(&hold, static_cast<std::uint32_t>(0x10000 + i));
+
+                const auto type = static_cast<Tables::TYPE>(1 + random.Next(TypeCount));
+                const auto difficulty = static_cast<Tables::DIFFICULTY>(1 + random.Next(DifficultyCount));
+                auto& owner = owners[(static_cast<std::size_t>(type) - 1) * DifficultyCount + static_cast<std::size_t>(difficulty) - 1];
+
+                quests.push_back(std::make_shared<Quest>(&owner, &location, &hold, type, difficulty, "Location " + std::to_string(i)));
+                catalogue.Add(quests.back());
+            }
+        }
+
+        std::deque<Location> holds;
+        std::deque<Location> locations;
+        std::deque<Owner> owners;
+        std::vector<std::shared_ptr<Quest>> quests;
+        Catalogue::Index<Quest> catalogue;
+    };
+
+    inline auto ToHex(std::size_t a_value) -> std::string
+    {
+        char digits[16];
+        const auto [end, error] = std::to_chars(digits, digits + sizeof(digits), a_value, 16);
+        return "0x" + std::string(digits, end);
+    }
+
+    // A quest pack file in the shipped format with a_size entries.
+    inline auto MakeQuestsJson(std::size_t a_size) -> std::string
+    {
+        Random::PCG32 random;
+        random.Seed(a_size);
+
+        std::string result = "{\n  \"Quests\": [\n";
+        for (std::size_t i = 0; i < a_size; i++) {
+            const auto type = static_cast<Tables::TYPE>(1 + random.Next(TypeCount));
+            const auto difficulty = static_cast<Tables::DIFFICULTY>(1 + random.Next(DifficultyCount));
+
+            result += "    {\n      \"LocationName\": \"Location " + std::to_string(i) + "\",\n";
+            result += "      \"Difficulty\": \"" + std::string(Tables::GetName(Tables::Difficulties, difficulty)) + "\",\n";
+            result += "      \"Type\": \"" + std::string(Tables::GetName(Tables::Types, type)) + "\",\n";
+            result += "      \"Location\": { \"FormID\": \"" + ToHex(0x10000 + i) + "\", \"ModName\": \"Skyrim.esm\" },\n";
+            result += "      \"Region\": { \"FormID\": \"" + ToHex(0x100 + random.Next(HoldCount)) + "\", \"ModName\": \"Skyrim.esm\" },\n";
+            result += "      \"Quest\": { \"FormID\": \"" + ToHex(0x800 + random.Next(TypeCount * DifficultyCount)) + "\", \"ModName\": \"Bounty Quests Redone - NG.esl\" }\n";
+            result += i + 1 < a_size ? "    },\n" : "    }\n";
+        }
+        result += "  ]\n}\n";
+
+        return result;
+    }
+}
@@ -0,0 +1,87 @@
+#include "Bench.h"
+#include "Fixture.h"
+#include "Store.h"
+
+#include <spdlog/async.h>
+#include <spdlog/sinks/basic_file_sink.h>
+#include <spdlog/spdlog.h>
+
+#include <filesystem>
+
+namespace
+{
+    struct Tracker
+    {
+        Fixture::Location* region;
+    };
+}
+
+// The location-change handler's work (type mask and tracked region lookups) plus the one line it
+// logs per event, under each logger InitializeLogger can build: level off, synchronous with a
+// flush per line, and the async ring buffer with its background flusher. The async run reports
+// how many lines overrun_oldest dropped; AsyncBlock is the same queue waiting instead of dropping.
+BENCH(EventLogging)
+{
+    constexpr std::size_t size{ 10000 };
+
+    Fixture::World world(size);
+
+    Store::Trackers<Tracker> trackers;
+    for (auto& hold : world.holds) {
+        trackers.Add(std::make_shared<Tracker>(&hold));
+    }
+
+    Random::PCG32 random;
+    std::vector<Fixture::Location*> probes(256);
+    for (auto& probe : probes) {
+        probe = &world.locations[random.Next(static_cast<std::uint32_t>(world.locations.size()))];
+    }
+
+    const auto path = (std::filesystem::temp_directory_path() / "Bounty Quests Redone - NG Bench.log").string();
+
+    const auto run = [&](std::string a_name, spdlog::logger& a_logger) -> Bench::Result& {
+        std::uint64_t mask = 0;
+        auto& result = Bench::Measure(std::move(a_name), size, probes.size(), [&]() {
+            for (const auto probe : probes) {
+                a_logger.info("Events::TESActorLocationChangeEvent :: Passing location: '{}' | '0x{:x}'", "Location", probe->formID);
+                mask += world.catalogue.GetLocationMask(probe);
+                mask += trackers.FindRegion(probe) ? 1 : 0;
+            }
+        });
+        Bench::Consume(mask);
+        return result;
+    };
+
+    {
+        spdlog::logger logger("off", std::make_shared<spdlog::sinks::basic_file_sink_mt>(path, true));
+        logger.set_level(spdlog::level::off);
+        run("EventLogging/Off", logger);
+    }
+
+    {
+        spdlog::logger logger("sync", std::make_shared<spdlog::sinks::basic_file_sink_mt>(path, true));
+        logger.flush_on(spdlog::level::info);
+        run("EventLogging/Sync", logger);
+    }
+
+    {
+        spdlog::init_thread_pool(8192, 1);
+        const auto logger = std::make_shared<spdlog::async_logger>("async", std::make_shared<spdlog::sinks::basic_file_sink_mt>(path, true), spdlog::thread_pool(), spdlog::async_overflow_policy::overrun_oldest);
+        logger->flush_on(spdlog::level::warn);
+
+        auto& result = run("EventLogging/Async", *logger);
+        result.counters.emplace_back("overrun", static_cast<double>(spdlog::thread_pool()->overrun_counter()));
+    }
+
+    {
+        spdlog::init_thread_pool(8192, 1);
+        const auto logger = std::make_shared<spdlog::async_logger>("block", std::make_shared<spdlog::sinks::basic_file_sink_mt>(path, true), spdlog::thread_pool(), spdlog::async_overflow_policy::block);
+        logger->flush_on(spdlog::level::warn);
+
+        run("EventLogging/AsyncBlock", *logger);
+    }
+
+    spdlog::shutdown();
+    std::error_code error;
+    std::filesystem::remove(path, error);
+}
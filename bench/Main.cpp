@@ -0,0 +1,53 @@
+#include "Bench.h"
+
+#include <cstdlib>
+#include <new>
+
+void* operator new(std::size_t a_size)
+{
+    Bench::Allocations.fetch_add(1, std::memory_order_relaxed);
+
+    if (const auto pointer = std::malloc(a_size ? a_size : 1); pointer) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* a_pointer) noexcept
+{
+    std::free(a_pointer);
+}
+
+void operator delete(void* a_pointer, std::size_t) noexcept
+{
+    std::free(a_pointer);
+}
+
+// Usage: bench [filter] > report.json. Runs every case whose name contains the filter and writes
+// the report to stdout; progress goes to stderr.
+int main(int a_argc, char* a_argv[])
+{
+    const std::string_view filter = a_argc > 1 ? a_argv[1] : "";
+
+    for (const auto& [name, body] : Bench::GetCases()) {
+        if (name.find(filter) != std::string_view::npos) {
+            body();
+        }
+    }
+
+    const auto& results = Bench::GetResults();
+
+    std::printf("{\n  \"results\": [\n");
+    for (std::size_t i = 0; i < results.size(); i++) {
+        const auto& [name, size, operations, nanoseconds, allocations, counters] = results[i];
+
+        std::printf("    { \"name\": \"%s\", \"size\": %zu, \"operations\": %llu, \"ns_per_op\": %.2f, \"allocations_per_op\": %.2f", name.c_str(), size, static_cast<unsigned long long>(operations), nanoseconds, allocations);
+        for (const auto& [counter, value] : counters) {
+            std::printf(", \"%s\": %.2f", counter.c_str(), value);
+        }
+        std::printf(" }%s\n", i + 1 < results.size() ? "," : "");
+    }
+    std::printf("  ]\n}\n");
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+#include "Bench.h"
+#include "Fixture.h"
+#include "Records.h"
+#include "Store.h"
+
+#include <unordered_map>
+
+// Serialization's save and load of the objective and reservation records: Store to records to
+// bytes and back into a fresh Store, with FormID lookups standing in for LookupByID. One
+// objective per catalogue quest and one reservation per ten.
+BENCH(SaveLoadRoundTrip)
+{
+    for (const auto size : Bench::Sizes) {
+        Fixture::World world(size);
+
+        std::unordered_map<std::uint32_t, Fixture::Owner*> owners;
+        for (auto& owner : world.owners) {
+            owners.try_emplace(owner.formID, &owner);
+        }
+
+        std::unordered_map<std::uint32_t, Fixture::Location*> locations;
+        for (auto& location : world.locations) {
+            locations.try_emplace(location.formID, &location);
+        }
+
+        Store::Objectives<Fixture::Owner, Fixture::Location> objectives;
+        Store::Reservations<Fixture::Location> reservations;
+        for (std::size_t i = 0; i < world.quests.size(); i++) {
+            const auto& quest = world.quests[i];
+            objectives.Store(quest->quest, quest->location, static_cast<std::uint16_t>(i % 128), "Clear out " + quest->name + " in the hold");
+            if (i % 10 == 0) {
+                reservations.Insert(quest->location);
+            }
+        }
+
+        std::size_t bytes = 0;
+        auto& result = Bench::Measure("SaveLoadRoundTrip", size, 1, [&]() {
+            std::vector<Records::Objective> savedObjectives;
+            savedObjectives.reserve(objectives.GetObjectives().size());
+            for (const auto& objective : objectives.GetObjectives()) {
+                savedObjectives.emplace_back(objective->quest->formID, objective->location->formID, objective->index, objective->text);
+            }
+
+            std::vector<std::uint32_t> savedLocations;
+            for (const auto location : reservations.GetLocations()) {
+                savedLocations.push_back(location->formID);
+            }
+
+            Binary::Writer objectiveWriter;
+            Records::EncodeObjectives(objectiveWriter, savedObjectives);
+            Binary::Writer locationWriter;
+            Records::EncodeLocations(locationWriter, savedLocations);
+            bytes = objectiveWriter.GetData().size() + locationWriter.GetData().size();
+
+            std::vector<Records::Objective> loadedObjectives;
+            Binary::Reader objectiveReader(objectiveWriter.GetData());
+            Records::DecodeObjectives(objectiveReader, loadedObjectives);
+
+            std::vector<std::uint32_t> loadedLocations;
+            Binary::Reader locationReader(locationWriter.GetData());
+            Records::DecodeLocations(locationReader, loadedLocations);
+
+            Store::Objectives<Fixture::Owner, Fixture::Location> restored;
+            for (auto& record : loadedObjectives) {
+                restored.Store(owners.at(record.quest), locations.at(record.location), record.index, std::move(record.text));
+            }
+
+            Store::Reservations<Fixture::Location> restoredReservations;
+            for (const auto formID : loadedLocations) {
+                restoredReservations.Insert(locations.at(formID));
+            }
+
+            Bench::Consume(restored.GetObjectives().size() + restoredReservations.GetLocations().size());
+        });
+
+        result.counters.emplace_back("bytes", static_cast<double>(bytes));
+    }
+}
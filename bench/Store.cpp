@@ -0,0 +1,133 @@
+#include "Bench.h"
+#include "Fixture.h"
+#include "Store.h"
+
+#include <unordered_map>
+
+namespace
+{
+    struct Tracker
+    {
+        Fixture::Location* region;
+        std::array<std::uint32_t, 7> completed;
+    };
+
+    constexpr std::size_t RewardCount{ 8 };
+}
+
+// System::RewardPlayer without the inventory calls: find the region's tracker and total every
+// configured reward against its completion counts. Independent of the catalogue size by design.
+BENCH(RewardComputation)
+{
+    for (const auto size : Bench::Sizes) {
+        Fixture::World world(size);
+
+        Store::Trackers<Tracker> trackers;
+        for (auto& hold : world.holds) {
+            trackers.Add(std::make_shared<Tracker>(&hold, std::array<std::uint32_t, 7>{ 0, 3, 2, 2, 1, 1, 0 }));
+        }
+
+        std::vector<std::array<std::uint32_t, 7>> rewards(RewardCount);
+        for (std::size_t i = 0; i < rewards.size(); i++) {
+            rewards[i] = { 0, 100, 200, 300, 400, 500, static_cast<std::uint32_t>(600 + i) };
+        }
+
+        std::uint64_t total = 0;
+        Bench::Measure("RewardComputation", size, world.holds.size(), [&]() {
+            for (auto& hold : world.holds) {
+                if (const auto tracker = trackers.Find(&hold); tracker) {
+                    for (const auto& reward : rewards) {
+                        total += Store::GetRewardQuantity(reward, tracker->completed);
+                    }
+                }
+            }
+        });
+
+        Bench::Consume(total);
+    }
+}
+
+// Applying a save's objective texts on load, one objective per catalogue quest. Indexed is what
+// Serialization does now: resolve through the catalogue and a per-owner objective map, then store
+// into the indexed Store. Linear is the path it replaced, which copied the quest list and scanned
+// it, each owner's objectives and the stored objectives once per record.
+BENCH(ObjectiveLoad)
+{
+    struct Stored
+    {
+        Fixture::Owner* quest;
+        Fixture::Location* location;
+        std::uint16_t index;
+        std::string text;
+    };
+
+    for (const auto size : { std::size_t{ 100 }, std::size_t{ 1000 }, std::size_t{ 5000 } }) {
+        Fixture::World world(size);
+
+        std::vector<Stored> loaded;
+        for (std::size_t i = 0; i < world.quests.size(); i++) {
+            const auto& quest = world.quests[i];
+            loaded.emplace_back(quest->quest, quest->location, static_cast<std::uint16_t>(i % Fixture::ObjectiveCount), "Clear out " + quest->name);
+        }
+
+        Bench::Measure("ObjectiveLoad/Indexed", size, 1, [&]() {
+            std::unordered_map<Fixture::Owner*, std::unordered_map<std::uint16_t, Fixture::Objective*>> questObjectives;
+            Store::Objectives<Fixture::Owner, Fixture::Location> objectives;
+
+            for (const auto& objective : loaded) {
+                if (!world.catalogue.IsOwner(objective.quest)) {
+                    continue;
+                }
+
+                if (const auto quest = world.catalogue.GetQuest(objective.quest, objective.location); quest) {
+                    quest->objectiveIndex = objective.index;
+                }
+
+                auto [it, inserted] = questObjectives.try_emplace(objective.quest);
+                if (inserted) {
+                    for (auto& instance : objective.quest->objectives) {
+                        it->second.try_emplace(instance.index, &instance);
+                    }
+                }
+
+                if (const auto instance = it->second.find(objective.index); instance != it->second.end()) {
+                    instance->second->displayText = objective.text;
+                }
+
+                objectives.Store(objective.quest, objective.location, objective.index, objective.text);
+            }
+
+            Bench::Consume(objectives.GetObjectives().size());
+        });
+
+        Bench::Measure("ObjectiveLoad/Linear", size, 1, [&]() {
+            std::vector<std::shared_ptr<Stored>> objectives;
+
+            for (const auto& objective : loaded) {
+                auto quests = world.catalogue.GetQuests();
+
+                for (auto& quest : quests) {
+                    if (quest->quest != objective.quest) {
+                        continue;
+                    }
+
+                    if (quest->location == objective.location) {
+                        quest->objectiveIndex = objective.index;
+                    }
+
+                    for (auto& instance : quest->quest->objectives) {
+                        if (instance.index == objective.index) {
+                            instance.displayText = objective.text;
+                        }
+                    }
+
+                    if (std::find_if(objectives.begin(), objectives.end(), [&](const std::shared_ptr<Stored>& a_stored) { return a_stored->location == objective.location; }) == objectives.end()) {
+                        objectives.push_back(std::make_shared<Stored>(objective));
+                    }
+                }
+            }
+
+            Bench::Consume(objectives.size());
+        });
+    }
+}
@@ -0,0 +1,97 @@
+#include "Bench.h"
+#include "Tables.h"
+
+#include <algorithm>
+#include <cctype>
+
+namespace
+{
+    // Util::GetType and GetDifficulty as they were before the tables: a lowercased copy of the
+    // argument compared against each name in turn.
+    auto GetTypeChain(std::string a_string) -> Tables::TYPE
+    {
+        std::transform(std::begin(a_string), std::end(a_string), std::begin(a_string), [](unsigned char c) -> unsigned char { return static_cast<unsigned char>(std::tolower(c)); });
+        if (a_string == "bandit") {
+            return Tables::TYPE::Bandit;
+        } else if (a_string == "dragon") {
+            return Tables::TYPE::Dragon;
+        } else if (a_string == "draugr") {
+            return Tables::TYPE::Draugr;
+        } else if (a_string == "dwemer") {
+            return Tables::TYPE::Dwemer;
+        } else if (a_string == "falmer") {
+            return Tables::TYPE::Falmer;
+        } else if (a_string == "forsworn") {
+            return Tables::TYPE::Forsworn;
+        } else if (a_string == "giant") {
+            return Tables::TYPE::Giant;
+        } else if (a_string == "mage") {
+            return Tables::TYPE::Mage;
+        } else if (a_string == "reaver") {
+            return Tables::TYPE::Reaver;
+        } else if (a_string == "riekling") {
+            return Tables::TYPE::Riekling;
+        } else if (a_string == "vampire") {
+            return Tables::TYPE::Vampire;
+        } else {
+            return Tables::TYPE::None;
+        }
+    }
+
+    auto GetDifficultyChain(std::string a_string) -> Tables::DIFFICULTY
+    {
+        std::transform(std::begin(a_string), std::end(a_string), std::begin(a_string), [](unsigned char c) -> unsigned char { return static_cast<unsigned char>(std::tolower(c)); });
+        if (a_string == "novice") {
+            return Tables::DIFFICULTY::Novice;
+        } else if (a_string == "apprentice") {
+            return Tables::DIFFICULTY::Apprentice;
+        } else if (a_string == "adept") {
+            return Tables::DIFFICULTY::Adept;
+        } else if (a_string == "expert") {
+            return Tables::DIFFICULTY::Expert;
+        } else if (a_string == "master") {
+            return Tables::DIFFICULTY::Master;
+        } else if (a_string == "legendary") {
+            return Tables::DIFFICULTY::Legendary;
+        } else {
+            return Tables::DIFFICULTY::None;
+        }
+    }
+
+    // Spelled the way the shipped packs spell them, plus names that match nothing.
+    const std::vector<std::string> TypeNames{ "Bandit", "Dragon", "Draugr", "Dwemer", "Falmer", "Forsworn", "Giant", "Mage", "Reaver", "Riekling", "Vampire", "Necromancer", "" };
+    const std::vector<std::string> DifficultyNames{ "Novice", "Apprentice", "Adept", "Expert", "Master", "Legendary", "Mythic", "" };
+}
+
+// The string-to-enum lookups parsing runs several times per quest: the sorted constexpr tables
+// taking string_view against the chain of compares they replaced.
+BENCH(TableLookup)
+{
+    std::uint64_t total = 0;
+
+    Bench::Measure("TypeLookup/Table", TypeNames.size(), TypeNames.size(), [&]() {
+        for (const auto& name : TypeNames) {
+            total += static_cast<std::uint64_t>(Tables::GetType(name));
+        }
+    });
+
+    Bench::Measure("TypeLookup/Chain", TypeNames.size(), TypeNames.size(), [&]() {
+        for (const auto& name : TypeNames) {
+            total += static_cast<std::uint64_t>(GetTypeChain(name));
+        }
+    });
+
+    Bench::Measure("DifficultyLookup/Table", DifficultyNames.size(), DifficultyNames.size(), [&]() {
+        for (const auto& name : DifficultyNames) {
+            total += static_cast<std::uint64_t>(Tables::GetDifficulty(name));
+        }
+    });
+
+    Bench::Measure("DifficultyLookup/Chain", DifficultyNames.size(), DifficultyNames.size(), [&]() {
+        for (const auto& name : DifficultyNames) {
+            total += static_cast<std::uint64_t>(GetDifficultyChain(name));
+        }
+    });
+
+    Bench::Consume(total);
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace Binary
+{
+    // FNV-1a, used to fingerprint source files for the catalogue cache.
+    inline auto Hash(std::span<const std::byte> a_data) -> std::uint64_t
+    {
+        std::uint64_t hash = 14695981039346656037ULL;
+        for (const auto byte : a_data) {
+            hash ^= static_cast<std::uint64_t>(byte);
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    // Values are always written little-endian so the output does not depend on the host.
+    class Writer
+    {
+    public:
+        template <class T>
+            requires (std::is_integral_v<T> && !std::is_same_v<T, bool>) || std::is_enum_v<T>
+        void Write(T a_value)
+        {
+            using U = std::make_unsigned_t<typename std::conditional_t<std::is_enum_v<T>, std::underlying_type<T>, std::type_identity<T>>::type>;
+            auto value = static_cast<U>(a_value);
+            for (std::size_t i = 0; i < sizeof(U); i++) {
+                data.push_back(static_cast<std::byte>(value & 0xFF));
+                value = static_cast<U>(value >> 8);
+            }
+        }
+
+        void WriteVarint(std::uint64_t a_value)
+        {
+            while (a_value >= 0x80) {
+                data.push_back(static_cast<std::byte>((a_value & 0x7F) | 0x80));
+                a_value >>= 7;
+            }
+            data.push_back(static_cast<std::byte>(a_value));
+        }
+
+        void WriteString(std::string_view a_string)
+        {
+            WriteVarint(a_string.size());
+            const auto bytes = reinterpret_cast<const std::byte*>(a_string.data());
+            data.insert(data.end(), bytes, bytes + a_string.size());
+        }
+
+        void Clear() { data.clear(); }
+        auto GetData() const -> const std::vector<std::byte>& { return data; }
+    private:
+        std::vector<std::byte> data;
+    };
+
+    class Reader
+    {
+    public:
+        explicit Reader(std::span<const std::byte> a_data) :
+            data(a_data)
+        {}
+
+        template <class T>
+            requires (std::is_integral_v<T> && !std::is_same_v<T, bool>) || std::is_enum_v<T>
+        bool Read(T& a_value)
+        {
+            using U = std::make_unsigned_t<typename std::conditional_t<std::is_enum_v<T>, std::underlying_type<T>, std::type_identity<T>>::type>;
+            if (data.size() - position < sizeof(U)) {
+                return false;
+            }
+            U value = 0;
+            for (std::size_t i = 0; i < sizeof(U); i++) {
+                value |= static_cast<U>(static_cast<U>(data[position++]) << (8 * i));
+            }
+            a_value = static_cast<T>(value);
+            return true;
+        }
+
+        bool ReadVarint(std::uint64_t& a_value)
+        {
+            a_value = 0;
+            for (std::uint32_t shift = 0; shift < 64; shift += 7) {
+                if (position >= data.size()) {
+                    return false;
+                }
+                const auto byte = static_cast<std::uint64_t>(data[position++]);
+                a_value |= (byte & 0x7F) << shift;
+                if (!(byte & 0x80)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool ReadString(std::string& a_string)
+        {
+            std::uint64_t size = 0;
+            if (!ReadVarint(size) || data.size() - position < size) {
+                return false;
+            }
+            a_string.assign(reinterpret_cast<const char*>(data.data() + position), static_cast<std::size_t>(size));
+            position += static_cast<std::size_t>(size);
+            return true;
+        }
+
+        auto GetRemaining() const -> std::size_t { return data.size() - position; }
+        bool IsEnd() const { return position == data.size(); }
+    private:
+        std::span<const std::byte> data;
+        std::size_t position{ 0 };
+    };
+}
@@ -0,0 +1,174 @@
+#pragma once
+
+#include "Binary.h"
+#include "Entries.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+// Catalogue.bin: every parsed config record plus the size, timestamp and hash of the files they
+// came from. Decode rejects a cache whose sources differ from the files on disk, so Config falls
+// back to parsing; the file I/O stays in Config.
+namespace Cache
+{
+    struct Source
+    {
+        std::string path;
+        std::uint64_t size;
+        std::int64_t time;
+        std::uint64_t hash;
+
+        bool operator==(const Source&) const = default;
+    };
+
+    // Quests grouped by the absolute path of their source file, so a reload touches only changed files.
+    using Quests = std::map<std::string, std::vector<Entries::Quest>>;
+
+    inline constexpr std::uint32_t Magic{ 0x42515243 };  // 'BQRC'
+    inline constexpr std::uint32_t Version{ 2 };
+
+    inline void WriteForm(Binary::Writer& a_writer, const Entries::Form& a_form)
+    {
+        a_writer.Write(a_form.formID);
+        a_writer.WriteString(a_form.modName);
+    }
+
+    inline bool ReadForm(Binary::Reader& a_reader, Entries::Form& a_form)
+    {
+        return a_reader.Read(a_form.formID) && a_reader.ReadString(a_form.modName);
+    }
+
+    template <class T, class F>
+    bool ReadArray(Binary::Reader& a_reader, std::vector<T>& a_array, F a_read)
+    {
+        std::uint64_t count = 0;
+        if (!a_reader.ReadVarint(count) || count > a_reader.GetRemaining()) {
+            return false;
+        }
+
+        a_array.clear();
+        a_array.resize(static_cast<std::size_t>(count));
+        for (auto& element : a_array) {
+            if (!a_read(element)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    inline void Encode(Binary::Writer& a_writer, const std::vector<Source>& a_sources, const Quests& a_quests, const std::vector<Entries::Reward>& a_rewards, const std::vector<Entries::Tracker>& a_trackers, const std::vector<Entries::Text>& a_texts)
+    {
+        a_writer.Write(Magic);
+        a_writer.Write(Version);
+
+        a_writer.WriteVarint(a_sources.size());
+        for (const auto& source : a_sources) {
+            a_writer.WriteString(source.path);
+            a_writer.Write(source.size);
+            a_writer.Write(source.time);
+            a_writer.Write(source.hash);
+        }
+
+        std::size_t count = 0;
+        for (const auto& [file, list] : a_quests) {
+            count += list.size();
+        }
+
+        a_writer.WriteVarint(count);
+        for (const auto& [file, list] : a_quests) {
+            for (const auto& quest : list) {
+                a_writer.WriteString(quest.name);
+                a_writer.WriteString(quest.difficulty);
+                WriteForm(a_writer, quest.location);
+                WriteForm(a_writer, quest.region);
+                WriteForm(a_writer, quest.quest);
+                a_writer.WriteString(quest.type);
+                a_writer.WriteString(quest.file);
+            }
+        }
+
+        a_writer.WriteVarint(a_rewards.size());
+        for (const auto& reward : a_rewards) {
+            WriteForm(a_writer, reward.form);
+            a_writer.WriteVarint(reward.amount.size());
+            for (const auto& [difficulty, amount] : reward.amount) {
+                a_writer.Write(difficulty);
+                a_writer.Write(amount);
+            }
+        }
+
+        a_writer.WriteVarint(a_trackers.size());
+        for (const auto& tracker : a_trackers) {
+            WriteForm(a_writer, tracker.global);
+            WriteForm(a_writer, tracker.region);
+        }
+
+        a_writer.WriteVarint(a_texts.size());
+        for (const auto& text : a_texts) {
+            a_writer.Write(text.text);
+            a_writer.WriteString(text.value);
+        }
+    }
+
+    // Fails on a truncated or foreign buffer and on any difference from a_sources; the outputs are
+    // left empty then.
+    inline bool Decode(Binary::Reader& a_reader, const std::vector<Source>& a_sources, Quests& a_quests, std::vector<Entries::Reward>& a_rewards, std::vector<Entries::Tracker>& a_trackers, std::vector<Entries::Text>& a_texts)
+    {
+        std::uint32_t magic = 0;
+        std::uint32_t version = 0;
+        std::vector<Source> cached;
+        std::vector<Entries::Quest> list;
+
+        const auto valid =
+            a_reader.Read(magic) && magic == Magic &&
+            a_reader.Read(version) && version == Version &&
+            ReadArray(a_reader, cached, [&](Source& a_source) {
+                return a_reader.ReadString(a_source.path) && a_reader.Read(a_source.size) && a_reader.Read(a_source.time) && a_reader.Read(a_source.hash);
+            }) &&
+            cached == a_sources &&
+            ReadArray(a_reader, list, [&](Entries::Quest& a_quest) {
+                return a_reader.ReadString(a_quest.name) && a_reader.ReadString(a_quest.difficulty) &&
+                       ReadForm(a_reader, a_quest.location) && ReadForm(a_reader, a_quest.region) && ReadForm(a_reader, a_quest.quest) &&
+                       a_reader.ReadString(a_quest.type) && a_reader.ReadString(a_quest.file);
+            }) &&
+            ReadArray(a_reader, a_rewards, [&](Entries::Reward& a_reward) {
+                std::uint64_t count = 0;
+                if (!ReadForm(a_reader, a_reward.form) || !a_reader.ReadVarint(count)) {
+                    return false;
+                }
+                for (std::uint64_t i = 0; i < count; i++) {
+                    Tables::DIFFICULTY difficulty;
+                    std::uint32_t amount = 0;
+                    if (!a_reader.Read(difficulty) || !a_reader.Read(amount)) {
+                        return false;
+                    }
+                    a_reward.amount[difficulty] = amount;
+                }
+                return true;
+            }) &&
+            ReadArray(a_reader, a_trackers, [&](Entries::Tracker& a_tracker) {
+                return ReadForm(a_reader, a_tracker.global) && ReadForm(a_reader, a_tracker.region);
+            }) &&
+            ReadArray(a_reader, a_texts, [&](Entries::Text& a_text) {
+                return a_reader.Read(a_text.text) && a_reader.ReadString(a_text.value);
+            }) &&
+            a_reader.IsEnd();
+
+        a_quests.clear();
+
+        if (!valid) {
+            a_rewards.clear();
+            a_trackers.clear();
+            a_texts.clear();
+            return false;
+        }
+
+        for (auto& quest : list) {
+            a_quests[quest.file].push_back(std::move(quest));
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,313 @@
+#pragma once
+
+#include "Random.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Region/type index over the quest catalogue. Quest is the adapter: it must expose location and
+// region pointers, an owning quest pointer, and type and difficulty enums, and its location type
+// must expose parentLoc. System instantiates it over RE:: forms and the host-side tests over stand-ins.
+// Nothing here locks; System guards it with catalogueLock.
+namespace Catalogue
+{
+    template <class Quest>
+    class Index
+    {
+    public:
+        using Location = std::remove_pointer_t<decltype(Quest::location)>;
+        using Owner = std::remove_pointer_t<decltype(Quest::quest)>;
+        using Type = decltype(Quest::type);
+        using List = std::vector<std::shared_ptr<Quest>>;
+
+        struct Region
+        {
+            List quests;
+            std::unordered_map<Type, List> types;
+            std::vector<Owner*> owners;
+            std::unordered_map<Owner*, std::size_t> ownerCounts;
+            std::uint32_t mask{ 0 };
+            Random::AliasTable sampler;
+            std::unordered_map<Type, Random::AliasTable> typeSamplers;
+        };
+
+        // Puts a quest on the board. A retained quest with the same owner and location is superseded:
+        // it is released and returned so the caller can carry its running state over.
+        auto Add(const std::shared_ptr<Quest>& a_quest) -> std::shared_ptr<Quest>
+        {
+            std::shared_ptr<Quest> superseded;
+
+            if (const auto it = locations.find(a_quest->location); it != locations.end()) {
+                const auto match = std::ranges::find_if(it->second, [&](const std::shared_ptr<Quest>& a_entry) { return a_entry->quest == a_quest->quest && retained.contains(a_entry.get()); });
+                if (match != it->second.end()) {
+                    superseded = *match;
+                    Release(superseded);
+                }
+            }
+
+            Link(a_quest);
+
+            positions.insert_or_assign(a_quest.get(), quests.size());
+            quests.push_back(a_quest);
+
+            auto& region = regions[a_quest->region];
+
+            region.quests.push_back(a_quest);
+            region.types[a_quest->type].push_back(a_quest);
+            region.mask |= 1U << static_cast<std::uint32_t>(a_quest->type);
+
+            return superseded;
+        }
+
+        void BuildSamplers(std::span<const double> a_weights)
+        {
+            for (auto& [location, region] : regions) {
+                BuildSamplers(region, a_weights);
+            }
+        }
+
+        void BuildSamplers(Location* a_region, std::span<const double> a_weights)
+        {
+            if (const auto it = regions.find(a_region); it != regions.end()) {
+                BuildSamplers(it->second, a_weights);
+            }
+        }
+
+        void Clear()
+        {
+            quests.clear();
+            positions.clear();
+            regions.clear();
+            locations.clear();
+            owners.clear();
+            retained.clear();
+            locationMasks.clear();
+        }
+
+        void ClearMasks() { locationMasks.clear(); }
+
+        bool Contains(Location* a_location) const { return locations.contains(a_location); }
+
+        // Walks the location's parents and ORs in every indexed region's type mask. Cached per
+        // location; the cache is only valid until the next Add/Remove, so callers ClearMasks then.
+        // The cache is the only state this writes, so readers sharing the index can serialise it alone.
+        auto GetLocationMask(Location* a_location) -> std::uint32_t
+        {
+            if (const auto it = locationMasks.find(a_location); it != locationMasks.end()) {
+                return it->second;
+            }
+
+            std::uint32_t mask = 0U;
+            for (auto currentLocation = a_location; currentLocation; currentLocation = currentLocation->parentLoc) {
+                if (const auto region = regions.find(currentLocation); region != regions.end()) {
+                    mask |= region->second.mask;
+                }
+            }
+
+            locationMasks.try_emplace(a_location, mask);
+            return mask;
+        }
+
+        auto GetOwners(Location* a_region) const -> const std::vector<Owner*>&
+        {
+            static const std::vector<Owner*> empty;
+
+            const auto it = regions.find(a_region);
+            return it != regions.end() ? it->second.owners : empty;
+        }
+
+        // The most recently added live quest (on the board or retained) for this owner and location.
+        auto GetQuest(Owner* a_owner, Location* a_location) const -> std::shared_ptr<Quest>
+        {
+            const auto it = locations.find(a_location);
+            if (it == locations.end()) {
+                return nullptr;
+            }
+
+            const auto match = std::find_if(it->second.rbegin(), it->second.rend(), [a_owner](const std::shared_ptr<Quest>& a_quest) { return a_quest->quest == a_owner; });
+            return match != it->second.rend() ? *match : nullptr;
+        }
+
+        // Every quest on the board, in no particular order: removals swap the last quest into the gap.
+        auto GetQuests() const -> const List& { return quests; }
+
+        auto GetQuests(Location* a_region) const -> const List&
+        {
+            static const List empty;
+
+            const auto it = regions.find(a_region);
+            return it != regions.end() ? it->second.quests : empty;
+        }
+
+        auto GetQuests(Location* a_region, Type a_type) const -> const List&
+        {
+            static const List empty;
+
+            const auto it = regions.find(a_region);
+            if (it == regions.end()) {
+                return empty;
+            }
+
+            const auto type = it->second.types.find(a_type);
+            return type != it->second.types.end() ? type->second : empty;
+        }
+
+        auto GetRegionCount() const -> std::size_t { return regions.size(); }
+
+        // A default-constructed type (None) selects the region-wide sampler.
+        auto GetSampler(Location* a_region, Type a_type) const -> const Random::AliasTable*
+        {
+            const auto it = regions.find(a_region);
+            if (it == regions.end()) {
+                return nullptr;
+            }
+
+            if (a_type == Type{}) {
+                return &it->second.sampler;
+            }
+
+            const auto sampler = it->second.typeSamplers.find(a_type);
+            return sampler != it->second.typeSamplers.end() ? &sampler->second : nullptr;
+        }
+
+        bool IsOwner(Owner* a_owner) const { return owners.contains(a_owner); }
+
+        bool IsRetained(const std::shared_ptr<Quest>& a_quest) const { return retained.contains(a_quest.get()); }
+
+        // Drops a quest that Remove retained, once it has completed. Returns false for any other quest.
+        bool Release(const std::shared_ptr<Quest>& a_quest)
+        {
+            if (!retained.erase(a_quest.get())) {
+                return false;
+            }
+
+            Unlink(a_quest);
+            return true;
+        }
+
+        // Removes the first quest in a_region matching a_match from the board. With a_retain the
+        // quest stays resolvable through GetQuest and keeps its owner until Release or a later Add
+        // supersedes it, so a quest that is still running can be finished.
+        template <class F>
+        auto Remove(Location* a_region, F a_match, bool a_retain) -> std::shared_ptr<Quest>
+        {
+            const auto it = regions.find(a_region);
+            if (it == regions.end()) {
+                return nullptr;
+            }
+
+            auto& region = it->second;
+            const auto match = std::ranges::find_if(region.quests, [&a_match](const std::shared_ptr<Quest>& a_quest) { return a_match(*a_quest); });
+
+            if (match == region.quests.end()) {
+                return nullptr;
+            }
+
+            const auto quest = *match;
+
+            region.quests.erase(match);
+
+            // Swap-and-pop keeps catalogue-wide removal O(1); only the region's own lists are scanned.
+            if (const auto position = positions.find(quest.get()); position != positions.end()) {
+                const auto index = position->second;
+                positions.erase(position);
+
+                if (index + 1 != quests.size()) {
+                    quests[index] = std::move(quests.back());
+                    positions.insert_or_assign(quests[index].get(), index);
+                }
+                quests.pop_back();
+            }
+
+            if (const auto type = region.types.find(quest->type); type != region.types.end()) {
+                std::erase(type->second, quest);
+                if (type->second.empty()) {
+                    region.types.erase(type);
+                    region.mask &= ~(1U << static_cast<std::uint32_t>(quest->type));
+                }
+            }
+
+            if (a_retain) {
+                retained.insert(quest.get());
+            } else {
+                Unlink(quest);
+            }
+
+            return quest;
+        }
+    private:
+        static void BuildSamplers(Region& a_region, std::span<const double> a_weights)
+        {
+            std::vector<double> buffer;
+
+            const auto build = [&a_weights, &buffer](Random::AliasTable& a_sampler, const List& a_quests) {
+                buffer.clear();
+                for (const auto& quest : a_quests) {
+                    const auto index = static_cast<std::size_t>(quest->difficulty);
+                    buffer.push_back(index < a_weights.size() ? a_weights[index] : 0.0);
+                }
+                a_sampler.Build(buffer);
+            };
+
+            build(a_region.sampler, a_region.quests);
+
+            a_region.typeSamplers.clear();
+            for (const auto& [type, list] : a_region.types) {
+                build(a_region.typeSamplers[type], list);
+            }
+        }
+
+        // Location and owner entries live as long as the quest is on the board or retained.
+        void Link(const std::shared_ptr<Quest>& a_quest)
+        {
+            locations[a_quest->location].push_back(a_quest);
+            owners[a_quest->quest]++;
+
+            auto& region = regions[a_quest->region];
+            if (region.ownerCounts[a_quest->quest]++ == 0) {
+                region.owners.push_back(a_quest->quest);
+            }
+        }
+
+        void Unlink(const std::shared_ptr<Quest>& a_quest)
+        {
+            if (const auto it = locations.find(a_quest->location); it != locations.end()) {
+                std::erase(it->second, a_quest);
+                if (it->second.empty()) {
+                    locations.erase(it);
+                }
+            }
+
+            if (const auto it = owners.find(a_quest->quest); it != owners.end() && --it->second == 0) {
+                owners.erase(it);
+            }
+
+            if (const auto it = regions.find(a_quest->region); it != regions.end()) {
+                auto& region = it->second;
+
+                if (const auto count = region.ownerCounts.find(a_quest->quest); count != region.ownerCounts.end() && --count->second == 0) {
+                    region.ownerCounts.erase(count);
+                    std::erase(region.owners, a_quest->quest);
+                }
+
+                if (region.quests.empty() && region.owners.empty()) {
+                    regions.erase(it);
+                }
+            }
+        }
+
+        List quests;
+        std::unordered_map<const Quest*, std::size_t> positions;
+        std::unordered_map<Location*, Region> regions;
+        std::unordered_map<Location*, List> locations;
+        std::unordered_map<Owner*, std::size_t> owners;
+        std::unordered_set<const Quest*> retained;
+        std::unordered_map<Location*, std::uint32_t> locationMasks;
+    };
+}
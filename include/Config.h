@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Cache.h"
+#include "Entries.h"
+#include "Util.h"
+
+class Config
+{
+public:
+    using Form = Entries::Form;
+    using Quest = Entries::Quest;
+    using Reward = Entries::Reward;
+    using Tracker = Entries::Tracker;
+    using Text = Entries::Text;
+
+    using Source = Cache::Source;
+
+    struct Changes
+    {
+        std::vector<Quest> added;
+        std::vector<Quest> removed;
+        std::size_t files;
+        std::size_t failed;
+    };
+
+    using Quests = Cache::Quests;
+
+    static Config* GetSingleton()
+    {
+        static Config singleton;
+        return &singleton;
+    }
+
+    auto GetQuests() const -> const Quests&;
+    auto GetRewards() const -> const std::vector<Reward>&;
+    auto GetTexts() const -> const std::vector<Text>&;
+    auto GetTrackers() const -> const std::vector<Tracker>&;
+    void Load();
+    auto Reload() -> Changes;
+private:
+    Config() = default;
+    Config(const Config&) = delete;
+    Config(Config&&) = delete;
+
+    ~Config() = default;
+
+    Config& operator=(const Config&) = delete;
+    Config& operator=(Config&&) = delete;
+
+    void DiffQuests(const std::string& a_file, std::vector<Quest> a_quests, Changes& a_changes);
+    bool ReadCache(const std::vector<Source>& a_sources);
+    void WriteCache(const std::vector<Source>& a_sources) const;
+
+    static auto GetSource(const std::filesystem::path& a_path) -> Source;
+    // Empty when the file fails to parse, as opposed to a file that parses but holds no quests.
+    static auto ReadQuests(const std::filesystem::path& a_path) -> std::optional<std::vector<Quest>>;
+    static auto ReadRewards(const std::filesystem::path& a_path) -> std::vector<Reward>;
+    static auto ReadTexts(const std::filesystem::path& a_path) -> std::vector<Text>;
+    static auto ReadTrackers(const std::filesystem::path& a_path) -> std::vector<Tracker>;
+
+    std::vector<Source> sources;
+    Quests quests;
+    std::vector<Reward> rewards;
+    std::vector<Text> texts;
+    std::vector<Tracker> trackers;
+};
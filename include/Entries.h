@@ -0,0 +1,213 @@
+#pragma once
+
+#include "Tables.h"
+
+#include <charconv>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Config records and the mapping from JSON events onto them. The parser itself stays outside:
+// Json.h feeds Builder from the jsoncons cursor, the host-side tests feed it by hand.
+namespace Entries
+{
+    struct Form
+    {
+        std::uint32_t formID;
+        std::string modName;
+
+        bool operator==(const Form&) const = default;
+    };
+
+    struct Quest
+    {
+        std::string name;
+        std::string difficulty;
+        Form location;
+        Form region;
+        Form quest;
+        std::string type;
+        std::string file;
+
+        bool operator==(const Quest&) const = default;
+    };
+
+    struct Reward
+    {
+        Form form;
+        std::unordered_map<Tables::DIFFICULTY, std::uint32_t> amount;
+    };
+
+    struct Tracker
+    {
+        Form global;
+        Form region;
+    };
+
+    struct Text
+    {
+        Tables::TEXT text;
+        std::string value;
+    };
+
+    template <class T>
+    auto ToInteger(std::string_view a_value) -> T
+    {
+        auto base = 10;
+        if (a_value.starts_with("0x") || a_value.starts_with("0X")) {
+            a_value.remove_prefix(2);
+            base = 16;
+        }
+
+        T result{};
+        const auto [end, error] = std::from_chars(a_value.data(), a_value.data() + a_value.size(), result, base);
+        if (error != std::errc() || end != a_value.data() + a_value.size()) {
+            throw std::invalid_argument("invalid integer value: '" + std::string(a_value) + "'");
+        }
+        return result;
+    }
+
+    inline bool ReadForm(Form& a_form, std::string_view a_key, std::string_view a_value)
+    {
+        if (a_key == "FormID") {
+            a_form.formID = ToInteger<std::uint32_t>(a_value);
+        } else if (a_key == "ModName") {
+            a_form.modName = a_value;
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    inline bool IsValid(const Form& a_form)
+    {
+        return a_form.formID && !a_form.modName.empty();
+    }
+
+    inline bool IsValid(const Quest& a_quest)
+    {
+        return !a_quest.name.empty() && !a_quest.difficulty.empty() && !a_quest.type.empty() && IsValid(a_quest.location) && IsValid(a_quest.region) && IsValid(a_quest.quest);
+    }
+
+    inline bool IsValid(const Reward& a_reward)
+    {
+        return IsValid(a_reward.form);
+    }
+
+    inline bool IsValid(const Tracker& a_tracker)
+    {
+        return IsValid(a_tracker.global) && IsValid(a_tracker.region);
+    }
+
+    // Field handlers for Builder, one per config file. a_parent is the key of the enclosing
+    // object, empty for the element's own fields.
+    inline void ReadQuest(Quest& a_quest, std::string_view a_parent, std::string_view a_key, std::string_view a_value)
+    {
+        if (a_parent.empty()) {
+            if (a_key == "LocationName") {
+                a_quest.name = a_value;
+            } else if (a_key == "Difficulty") {
+                a_quest.difficulty = a_value;
+            } else if (a_key == "Type") {
+                a_quest.type = a_value;
+            }
+        } else if (a_parent == "Location") {
+            ReadForm(a_quest.location, a_key, a_value);
+        } else if (a_parent == "Region") {
+            ReadForm(a_quest.region, a_key, a_value);
+        } else if (a_parent == "Quest") {
+            ReadForm(a_quest.quest, a_key, a_value);
+        }
+    }
+
+    inline void ReadReward(Reward& a_reward, std::string_view a_parent, std::string_view a_key, std::string_view a_value)
+    {
+        if (a_parent.empty()) {
+            ReadForm(a_reward.form, a_key, a_value);
+        } else if (a_parent == "Quantity") {
+            if (const auto difficulty = Tables::GetDifficulty(a_key); difficulty != Tables::DIFFICULTY::None) {
+                a_reward.amount[difficulty] = ToInteger<std::uint32_t>(a_value);
+            }
+        }
+    }
+
+    inline void ReadTracker(Tracker& a_tracker, std::string_view a_parent, std::string_view a_key, std::string_view a_value)
+    {
+        if (a_parent == "GlobalVariable") {
+            ReadForm(a_tracker.global, a_key, a_value);
+        } else if (a_parent == "Region") {
+            ReadForm(a_tracker.region, a_key, a_value);
+        }
+    }
+
+    // Each Texts element is a bag of difficulty names, so one element yields several texts.
+    inline void ReadTexts(std::vector<Text>& a_texts, std::string_view a_parent, std::string_view a_key, std::string_view a_value)
+    {
+        if (!a_parent.empty()) {
+            return;
+        }
+
+        if (a_key == "Objective") {
+            a_texts.emplace_back(Tables::TEXT::Objective, std::string(a_value));
+        } else if (const auto difficulty = Tables::GetDifficulty(a_key); difficulty != Tables::DIFFICULTY::None) {
+            a_texts.emplace_back(static_cast<Tables::TEXT>(difficulty), std::string(a_value));
+        }
+    }
+
+    // Builds one T per element of `{ "<root>": [ { ... }, ... ] }` from a stream of parser events.
+    // Every scalar inside an element is passed to a_field with the key of its enclosing object.
+    template <class T, class F>
+    class Builder
+    {
+    public:
+        Builder(std::string_view a_root, F a_field) :
+            root(a_root),
+            field(std::move(a_field))
+        {}
+
+        void Begin(bool a_object)
+        {
+            if (depth == 1) {
+                inRoot = key == root;
+            } else if (inRoot && depth == 2 && a_object) {
+                result.emplace_back();
+            } else if (inRoot && depth == 3) {
+                parent = key;
+            }
+            depth++;
+        }
+
+        void End()
+        {
+            depth--;
+            if (depth == 3) {
+                parent.clear();
+            } else if (depth == 1) {
+                inRoot = false;
+            }
+        }
+
+        void Key(std::string_view a_key) { key = a_key; }
+
+        void Value(std::string_view a_value)
+        {
+            if (inRoot && depth >= 3 && !result.empty()) {
+                field(result.back(), std::string_view(parent), std::string_view(key), a_value);
+            }
+        }
+
+        auto Take() -> std::vector<T> { return std::move(result); }
+    private:
+        std::string root;
+        F field;
+        std::vector<T> result;
+        std::size_t depth{ 0 };
+        bool inRoot{ false };
+        std::string parent;
+        std::string key;
+    };
+}
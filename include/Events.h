@@ -5,7 +5,8 @@ using EventResult = RE::BSEventNotifyControl;
 class Events final : 
     public RE::BSTEventSink<RE::MenuOpenCloseEvent>,
     public RE::BSTEventSink<RE::TESActorLocationChangeEvent>, 
-    public RE::BSTEventSink<RE::TESContainerChangedEvent>
+    public RE::BSTEventSink<RE::TESContainerChangedEvent>,
+    public RE::BSTEventSink<RE::TESDeathEvent>
     
 {
 public:
@@ -15,6 +16,7 @@ private:
     EventResult ProcessEvent(const RE::MenuOpenCloseEvent* a_event, RE::BSTEventSource<RE::MenuOpenCloseEvent>*) override;
     EventResult ProcessEvent(const RE::TESActorLocationChangeEvent* a_event, RE::BSTEventSource<RE::TESActorLocationChangeEvent>*) override;
     EventResult ProcessEvent(const RE::TESContainerChangedEvent* a_event, RE::BSTEventSource<RE::TESContainerChangedEvent>*) override;
+    EventResult ProcessEvent(const RE::TESDeathEvent* a_event, RE::BSTEventSource<RE::TESDeathEvent>*) override;
     
 
     Events() = default;
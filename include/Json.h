@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Entries.h"
+
+#include <jsoncons/json_cursor.hpp>
+
+#include <istream>
+
+// The jsoncons side of Entries: streams a config file through Builder without building a DOM.
+// Depends on nothing but jsoncons, so the bench reads configs exactly the way Config does.
+namespace Json
+{
+    template <class T, class F>
+    auto ReadEntries(std::istream& a_stream, std::string_view a_root, F a_field) -> std::vector<T>
+    {
+        Entries::Builder<T, F> builder(a_root, std::move(a_field));
+        jsoncons::json_stream_cursor cursor(a_stream);
+
+        for (; !cursor.done(); cursor.next()) {
+            const auto& event = cursor.current();
+
+            switch (event.event_type()) {
+            case jsoncons::staj_event_type::begin_object:
+                builder.Begin(true);
+                break;
+            case jsoncons::staj_event_type::begin_array:
+                builder.Begin(false);
+                break;
+            case jsoncons::staj_event_type::end_object:
+            case jsoncons::staj_event_type::end_array:
+                builder.End();
+                break;
+            case jsoncons::staj_event_type::key:
+                builder.Key(event.get<std::string_view>());
+                break;
+            default:
+                builder.Value(event.get<std::string>());
+                break;
+            }
+        }
+
+        return builder.Take();
+    }
+}
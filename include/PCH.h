@@ -3,14 +3,20 @@
 #include <RE/Skyrim.h>
 #include <SKSE/SKSE.h>
 
+#include <spdlog/async.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/msvc_sink.h>
 
 #include <jsoncons/json.hpp>
+#include <jsoncons/json_cursor.hpp>
 
 #define ERROR(message, ...) SKSE::log::error(message, ##__VA_ARGS__)
 #define INFO(message, ...) SKSE::log::info(message, ##__VA_ARGS__)
+#ifdef BQRNG_TRACE
 #define TRACE(message, ...) SKSE::log::trace(message, ##__VA_ARGS__)
+#else
+#define TRACE(message, ...) static_cast<void>(0)
+#endif
 #define WARN(message, ...) SKSE::log::warn(message, ##__VA_ARGS__)
 
 namespace stl
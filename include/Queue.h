@@ -0,0 +1,52 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+#include <vector>
+
+// Lock-free multi-producer/single-consumer queue. Producers push onto an intrusive stack and the
+// consumer detaches the whole stack in one exchange, reversing it to restore FIFO order.
+template <class T>
+class MPSCQueue
+{
+public:
+    MPSCQueue() = default;
+    MPSCQueue(const MPSCQueue&) = delete;
+    MPSCQueue(MPSCQueue&&) = delete;
+
+    ~MPSCQueue() { Drain(); }
+
+    MPSCQueue& operator=(const MPSCQueue&) = delete;
+    MPSCQueue& operator=(MPSCQueue&&) = delete;
+
+    void Push(T a_value)
+    {
+        auto node = new Node{ std::move(a_value), head.load(std::memory_order_relaxed) };
+        while (!head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {}
+    }
+
+    auto Drain() -> std::vector<T>
+    {
+        std::vector<T> result;
+
+        auto node = head.exchange(nullptr, std::memory_order_acquire);
+        while (node) {
+            result.push_back(std::move(node->value));
+            delete std::exchange(node, node->next);
+        }
+
+        std::reverse(result.begin(), result.end());
+        return result;
+    }
+
+    bool IsEmpty() const { return head.load(std::memory_order_acquire) == nullptr; }
+private:
+    struct Node
+    {
+        T value;
+        Node* next;
+    };
+
+    std::atomic<Node*> head{ nullptr };
+};
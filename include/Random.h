@@ -0,0 +1,153 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Random
+{
+    // PCG-XSH-RR 32 (O'Neill). Small, fast and fully described by two integers, so the state
+    // can be stored in the cosave and selections replayed exactly.
+    class PCG32
+    {
+    public:
+        struct State
+        {
+            std::uint64_t state;
+            std::uint64_t increment;
+        };
+
+        PCG32() { Seed(0x853C49E6748FEA9BULL); }
+
+        void Seed(std::uint64_t a_seed, std::uint64_t a_stream = 0xDA3E39CB94B95BDBULL)
+        {
+            state = 0;
+            increment = (a_stream << 1) | 1;
+            Next();
+            state += a_seed;
+            Next();
+        }
+
+        auto Next() -> std::uint32_t
+        {
+            const auto previous = state;
+            state = previous * 6364136223846793005ULL + increment;
+
+            const auto xorshifted = static_cast<std::uint32_t>(((previous >> 18) ^ previous) >> 27);
+            const auto rotation = static_cast<std::uint32_t>(previous >> 59);
+            return (xorshifted >> rotation) | (xorshifted << ((32 - rotation) & 31));
+        }
+
+        // Unbiased value in [0, a_bound) using Lemire's multiply-and-reject.
+        auto Next(std::uint32_t a_bound) -> std::uint32_t
+        {
+            auto product = static_cast<std::uint64_t>(Next()) * a_bound;
+            auto low = static_cast<std::uint32_t>(product);
+
+            if (low < a_bound) {
+                const auto threshold = static_cast<std::uint32_t>(-a_bound) % a_bound;
+                while (low < threshold) {
+                    product = static_cast<std::uint64_t>(Next()) * a_bound;
+                    low = static_cast<std::uint32_t>(product);
+                }
+            }
+
+            return static_cast<std::uint32_t>(product >> 32);
+        }
+
+        // Uniform double in [0, 1).
+        auto NextDouble() -> double
+        {
+            const auto value = (static_cast<std::uint64_t>(Next()) << 21) ^ (Next() >> 11);
+            return static_cast<double>(value) * 0x1.0p-53;
+        }
+
+        auto GetState() const -> State { return { state, increment }; }
+        void SetState(const State& a_state)
+        {
+            state = a_state.state;
+            increment = a_state.increment | 1;
+        }
+    private:
+        std::uint64_t state;
+        std::uint64_t increment;
+    };
+
+    // Walker/Vose alias table: O(n) to build, O(1) and allocation-free to sample.
+    class AliasTable
+    {
+    public:
+        void Build(std::span<const double> a_weights)
+        {
+            const auto size = a_weights.size();
+
+            thresholds.assign(size, 0);
+            aliases.assign(size, 0);
+
+            double total = 0.0;
+            for (const auto weight : a_weights) {
+                total += weight > 0.0 ? weight : 0.0;
+            }
+
+            if (size == 0 || total <= 0.0) {
+                thresholds.clear();
+                aliases.clear();
+                return;
+            }
+
+            std::vector<double> scaled(size);
+            std::vector<std::uint32_t> small;
+            std::vector<std::uint32_t> large;
+
+            for (std::size_t i = 0; i < size; i++) {
+                scaled[i] = (a_weights[i] > 0.0 ? a_weights[i] : 0.0) * static_cast<double>(size) / total;
+                (scaled[i] < 1.0 ? small : large).push_back(static_cast<std::uint32_t>(i));
+            }
+
+            while (!small.empty() && !large.empty()) {
+                const auto less = small.back();
+                small.pop_back();
+                const auto more = large.back();
+
+                thresholds[less] = ToThreshold(scaled[less]);
+                aliases[less] = more;
+
+                scaled[more] -= 1.0 - scaled[less];
+                if (scaled[more] < 1.0) {
+                    large.pop_back();
+                    small.push_back(more);
+                }
+            }
+
+            // Whatever is left is 1 up to rounding error.
+            for (const auto index : large) {
+                thresholds[index] = kAlways;
+                aliases[index] = index;
+            }
+            for (const auto index : small) {
+                thresholds[index] = kAlways;
+                aliases[index] = index;
+            }
+        }
+
+        auto Sample(PCG32& a_random) const -> std::size_t
+        {
+            const auto column = a_random.Next(static_cast<std::uint32_t>(thresholds.size()));
+            return static_cast<std::uint64_t>(a_random.Next()) < thresholds[column] ? column : aliases[column];
+        }
+
+        bool IsEmpty() const { return thresholds.empty(); }
+        auto GetSize() const -> std::size_t { return thresholds.size(); }
+    private:
+        static constexpr std::uint64_t kAlways{ 1ULL << 32 };
+
+        static auto ToThreshold(double a_probability) -> std::uint64_t
+        {
+            return static_cast<std::uint64_t>(a_probability * static_cast<double>(kAlways));
+        }
+
+        std::vector<std::uint64_t> thresholds;
+        std::vector<std::uint32_t> aliases;
+    };
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Binary.h"
+#include "Recording.h"
+
+// Appends the inputs the plugin reacts to (menu, location and container events and Papyrus
+// native calls) to a compact binary trace so tester sessions can be replayed offline. The layout
+// lives in Recording.h; the replay target reads it back.
+class Recorder
+{
+public:
+    using Event = Recording::Event;
+    using Menu = Recording::Menu;
+
+    static Recorder* GetSingleton()
+    {
+        static Recorder singleton;
+        return &singleton;
+    }
+
+    void Flush();
+    bool IsEnabled() const { return enabled.load(std::memory_order_relaxed); }
+    void Record(Event a_event, std::initializer_list<std::uint64_t> a_values);
+    void SetEnabled(bool a_enabled);
+private:
+    Recorder() = default;
+    Recorder(const Recorder&) = delete;
+    Recorder(Recorder&&) = delete;
+
+    ~Recorder() = default;
+
+    Recorder& operator=(const Recorder&) = delete;
+    Recorder& operator=(Recorder&&) = delete;
+
+    void FlushLocked();
+
+    static constexpr std::size_t kFlushSize{ 64 * 1024 };
+
+    std::atomic<bool> enabled{ false };
+    std::mutex lock;
+    std::filesystem::path path;
+    Binary::Writer writer;
+    std::chrono::steady_clock::time_point last;
+    std::uint64_t records{ 0 };
+};
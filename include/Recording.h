@@ -0,0 +1,104 @@
+#pragma once
+
+#include "Binary.h"
+
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+// The event trace Recorder writes and the replay tool reads. Kept free of SKSE so both sides share
+// one definition of the layout.
+//
+// File layout: u32 magic 'BQRT', u32 version, then one record per event:
+//   u8 event, varint microseconds since the previous record, varint count, count x varint.
+namespace Recording
+{
+    enum class Event : std::uint8_t
+    {
+        MenuOpenClose,
+        LocationChange,
+        ContainerChanged,
+        ShowMenu,
+        StartEveryQuest,
+        StartRandomQuest,
+        RewardPlayer,
+        UpdateReward
+    };
+
+    // Values are part of the trace format: append new menus before Other, never reorder.
+    enum class Menu : std::uint8_t
+    {
+        GiftMenu,
+        DialogueMenu,
+        BarterMenu,
+        ContainerMenu,
+        InventoryMenu,
+        JournalMenu,
+        LoadingMenu,
+        MapMenu,
+        Other = 0xFF
+    };
+
+    // 'BQRT' as MSVC evaluates the multi-character literal the format was first written with.
+    inline constexpr std::uint32_t Magic{ 0x42515254 };
+    inline constexpr std::uint32_t Version{ 1 };
+
+    struct Record
+    {
+        Event event;
+        std::uint64_t delta;
+        std::vector<std::uint64_t> values;
+    };
+
+    inline void EncodeHeader(Binary::Writer& a_writer)
+    {
+        a_writer.Write(Magic);
+        a_writer.Write(Version);
+    }
+
+    inline void Encode(Binary::Writer& a_writer, Event a_event, std::uint64_t a_delta, std::span<const std::uint64_t> a_values)
+    {
+        a_writer.Write(a_event);
+        a_writer.WriteVarint(a_delta);
+        a_writer.WriteVarint(a_values.size());
+        for (const auto value : a_values) {
+            a_writer.WriteVarint(value);
+        }
+    }
+
+    // Reads a whole trace. A file cut short mid-record (the game closed between flushes) keeps the
+    // records before the cut and returns false, as does a wrong magic, version or event.
+    inline bool Decode(std::span<const std::byte> a_data, std::vector<Record>& a_records)
+    {
+        a_records.clear();
+
+        Binary::Reader reader(a_data);
+
+        std::uint32_t magic = 0;
+        std::uint32_t version = 0;
+        if (!reader.Read(magic) || !reader.Read(version) || magic != Magic || version != Version) {
+            return false;
+        }
+
+        while (!reader.IsEnd()) {
+            Record record{};
+            std::uint64_t count = 0;
+
+            if (!reader.Read(record.event) || record.event > Event::UpdateReward || !reader.ReadVarint(record.delta) || !reader.ReadVarint(count) || count > reader.GetRemaining()) {
+                return false;
+            }
+
+            record.values.resize(static_cast<std::size_t>(count));
+            for (auto& value : record.values) {
+                if (!reader.ReadVarint(value)) {
+                    return false;
+                }
+            }
+
+            a_records.push_back(std::move(record));
+        }
+
+        return true;
+    }
+}
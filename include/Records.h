@@ -0,0 +1,307 @@
+#pragma once
+
+#include "Binary.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Cosave record layouts and their codecs. Only raw FormIDs are stored here so the format can be
+// exercised without the game; Serialization resolves them against the running session.
+namespace Records
+{
+    struct Objective
+    {
+        std::uint32_t quest;
+        std::uint32_t location;
+        std::uint16_t index;
+        std::string text;
+    };
+
+    struct Tracker
+    {
+        std::uint32_t global;
+        std::uint32_t region;
+        std::unordered_map<std::uint32_t, std::uint32_t> reward;
+    };
+
+    // v2: the objective texts are interned once and each record refers to them by index.
+    inline void EncodeObjectives(Binary::Writer& a_writer, const std::vector<Objective>& a_records)
+    {
+        std::vector<std::string_view> strings;
+        std::unordered_map<std::string_view, std::uint64_t> stringIndexes;
+        std::vector<std::uint64_t> textIndexes;
+        textIndexes.reserve(a_records.size());
+
+        for (const auto& record : a_records) {
+            const auto [it, inserted] = stringIndexes.try_emplace(record.text, strings.size());
+            if (inserted) {
+                strings.push_back(record.text);
+            }
+            textIndexes.push_back(it->second);
+        }
+
+        a_writer.WriteVarint(strings.size());
+        for (const auto& string : strings) {
+            a_writer.WriteString(string);
+        }
+
+        a_writer.WriteVarint(a_records.size());
+        for (std::size_t i = 0; i < a_records.size(); i++) {
+            a_writer.Write(a_records[i].quest);
+            a_writer.Write(a_records[i].location);
+            a_writer.WriteVarint(a_records[i].index);
+            a_writer.WriteVarint(textIndexes[i]);
+        }
+    }
+
+    inline bool DecodeObjectives(Binary::Reader& a_reader, std::vector<Objective>& a_records)
+    {
+        std::uint64_t count = 0;
+        if (!a_reader.ReadVarint(count) || count > a_reader.GetRemaining()) {
+            return false;
+        }
+
+        std::vector<std::string> strings(static_cast<std::size_t>(count));
+        for (auto& string : strings) {
+            if (!a_reader.ReadString(string)) {
+                return false;
+            }
+        }
+
+        if (!a_reader.ReadVarint(count) || count > a_reader.GetRemaining()) {
+            return false;
+        }
+
+        a_records.reserve(static_cast<std::size_t>(count));
+        for (std::uint64_t i = 0; i < count; i++) {
+            Objective record{};
+            std::uint64_t index = 0;
+            std::uint64_t text = 0;
+
+            if (!a_reader.Read(record.quest) || !a_reader.Read(record.location) || !a_reader.ReadVarint(index) || !a_reader.ReadVarint(text) || text >= strings.size()) {
+                return false;
+            }
+
+            record.index = static_cast<std::uint16_t>(index);
+            record.text = strings[static_cast<std::size_t>(text)];
+            a_records.push_back(std::move(record));
+        }
+
+        return a_reader.IsEnd();
+    }
+
+    inline void EncodeLocations(Binary::Writer& a_writer, const std::vector<std::uint32_t>& a_records)
+    {
+        a_writer.WriteVarint(a_records.size());
+        for (const auto formID : a_records) {
+            a_writer.Write(formID);
+        }
+    }
+
+    inline bool DecodeLocations(Binary::Reader& a_reader, std::vector<std::uint32_t>& a_records)
+    {
+        std::uint64_t count = 0;
+        if (!a_reader.ReadVarint(count) || count > a_reader.GetRemaining()) {
+            return false;
+        }
+
+        a_records.resize(static_cast<std::size_t>(count));
+        for (auto& formID : a_records) {
+            if (!a_reader.Read(formID)) {
+                return false;
+            }
+        }
+
+        return a_reader.IsEnd();
+    }
+
+    inline void EncodeTrackers(Binary::Writer& a_writer, const std::vector<Tracker>& a_records)
+    {
+        a_writer.WriteVarint(a_records.size());
+        for (const auto& record : a_records) {
+            a_writer.Write(record.global);
+            a_writer.Write(record.region);
+            a_writer.WriteVarint(record.reward.size());
+
+            for (const auto& [difficulty, quantity] : record.reward) {
+                a_writer.Write(static_cast<std::uint8_t>(difficulty));
+                a_writer.WriteVarint(quantity);
+            }
+        }
+    }
+
+    inline bool DecodeTrackers(Binary::Reader& a_reader, std::vector<Tracker>& a_records)
+    {
+        std::uint64_t count = 0;
+        if (!a_reader.ReadVarint(count) || count > a_reader.GetRemaining()) {
+            return false;
+        }
+
+        a_records.reserve(static_cast<std::size_t>(count));
+        for (std::uint64_t i = 0; i < count; i++) {
+            Tracker record{};
+            std::uint64_t amount = 0;
+
+            if (!a_reader.Read(record.global) || !a_reader.Read(record.region) || !a_reader.ReadVarint(amount)) {
+                return false;
+            }
+
+            for (std::uint64_t j = 0; j < amount; j++) {
+                std::uint8_t difficulty = 0;
+                std::uint64_t quantity = 0;
+
+                if (!a_reader.Read(difficulty) || !a_reader.ReadVarint(quantity)) {
+                    return false;
+                }
+
+                record.reward.try_emplace(difficulty, static_cast<std::uint32_t>(quantity));
+            }
+
+            a_records.push_back(std::move(record));
+        }
+
+        return a_reader.IsEnd();
+    }
+
+    // The readers below take any interface exposing SKSE's ReadRecordData(void*, std::uint32_t),
+    // which returns the number of bytes actually read.
+    template <class Interface, class T>
+    bool ReadValue(Interface* a_interface, T& a_value)
+    {
+        return a_interface->ReadRecordData(&a_value, static_cast<std::uint32_t>(sizeof(T))) == sizeof(T);
+    }
+
+    template <class Interface>
+    bool ReadBuffer(Interface* a_interface, std::uint32_t a_length, std::vector<std::byte>& a_buffer)
+    {
+        a_buffer.resize(a_length);
+        return a_interface->ReadRecordData(a_buffer.data(), a_length) == a_length;
+    }
+
+    // v1 wrote counts and string lengths as 64-bit size_t followed by the raw fields.
+    // Credits to Papyrus Extender by powerofthree for the original string layout.
+    template <class Interface>
+    bool ReadLegacyString(Interface* a_interface, std::string& a_string)
+    {
+        std::uint64_t size = 0;
+        if (!ReadValue(a_interface, size) || size > UINT32_MAX) {
+            return false;
+        }
+
+        a_string.resize(static_cast<std::size_t>(size));
+        if (a_interface->ReadRecordData(a_string.data(), static_cast<std::uint32_t>(size)) != size) {
+            return false;
+        }
+
+        if (!a_string.empty() && a_string.back() == '\0') {
+            a_string.pop_back();
+        }
+        return true;
+    }
+
+    template <class Interface>
+    bool ReadObjectives(Interface* a_interface, std::uint32_t a_version, std::uint32_t a_length, std::vector<Objective>& a_records)
+    {
+        if (a_version != 1) {
+            std::vector<std::byte> buffer;
+            if (!ReadBuffer(a_interface, a_length, buffer)) {
+                return false;
+            }
+
+            Binary::Reader reader(buffer);
+            return DecodeObjectives(reader, a_records);
+        }
+
+        std::uint64_t count = 0;
+        if (!ReadValue(a_interface, count)) {
+            return false;
+        }
+
+        for (std::uint64_t i = 0; i < count; i++) {
+            Objective record{};
+
+            if (!ReadValue(a_interface, record.quest) || !ReadValue(a_interface, record.location) || !ReadValue(a_interface, record.index) || !ReadLegacyString(a_interface, record.text)) {
+                return false;
+            }
+
+            a_records.push_back(std::move(record));
+        }
+
+        return true;
+    }
+
+    template <class Interface>
+    bool ReadLocations(Interface* a_interface, std::uint32_t a_version, std::uint32_t a_length, std::vector<std::uint32_t>& a_records)
+    {
+        if (a_version != 1) {
+            std::vector<std::byte> buffer;
+            if (!ReadBuffer(a_interface, a_length, buffer)) {
+                return false;
+            }
+
+            Binary::Reader reader(buffer);
+            return DecodeLocations(reader, a_records);
+        }
+
+        std::uint64_t count = 0;
+        if (!ReadValue(a_interface, count)) {
+            return false;
+        }
+
+        for (std::uint64_t i = 0; i < count; i++) {
+            std::uint32_t formID = 0;
+            if (!ReadValue(a_interface, formID)) {
+                return false;
+            }
+            a_records.push_back(formID);
+        }
+
+        return true;
+    }
+
+    template <class Interface>
+    bool ReadTrackers(Interface* a_interface, std::uint32_t a_version, std::uint32_t a_length, std::vector<Tracker>& a_records)
+    {
+        if (a_version != 1) {
+            std::vector<std::byte> buffer;
+            if (!ReadBuffer(a_interface, a_length, buffer)) {
+                return false;
+            }
+
+            Binary::Reader reader(buffer);
+            return DecodeTrackers(reader, a_records);
+        }
+
+        std::uint64_t count = 0;
+        if (!ReadValue(a_interface, count)) {
+            return false;
+        }
+
+        for (std::uint64_t i = 0; i < count; i++) {
+            Tracker record{};
+            std::uint64_t amount = 0;
+
+            if (!ReadValue(a_interface, record.global) || !ReadValue(a_interface, record.region) || !ReadValue(a_interface, amount)) {
+                return false;
+            }
+
+            for (std::uint64_t j = 0; j < amount; j++) {
+                std::uint32_t difficulty = 0;
+                std::uint32_t quantity = 0;
+
+                if (!ReadValue(a_interface, difficulty) || !ReadValue(a_interface, quantity)) {
+                    return false;
+                }
+
+                record.reward.try_emplace(difficulty, quantity);
+            }
+
+            a_records.push_back(std::move(record));
+        }
+
+        return true;
+    }
+}
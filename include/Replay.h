@@ -0,0 +1,386 @@
+#pragma once
+
+#include "Catalogue.h"
+#include "Entries.h"
+#include "Random.h"
+#include "Recording.h"
+#include "Store.h"
+#include "Tables.h"
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+// Offline replay of a Recorder trace through the same Catalogue::Index and Store containers System
+// and Serialization use, over a stand-in form table built from the config records. What needs the
+// game is left out: alias filling always succeeds, each started quest takes its owner's lowest free
+// objective index above 0, and note forms get sequential dynamic FormIDs in the order they are
+// first offered, as a fresh session creates them.
+namespace Replay
+{
+    // Runtime FormIDs the way the game assigns them: full plugins take the next load-order byte and
+    // light plugins (.esl) the next 0xFE slot. Plugins missing from the list are appended on first use.
+    class LoadOrder
+    {
+    public:
+        explicit LoadOrder(std::vector<std::string> a_plugins = { "Skyrim.esm", "Update.esm", "Dawnguard.esm", "HearthFires.esm", "Dragonborn.esm" })
+        {
+            for (auto& plugin : a_plugins) {
+                Add(std::move(plugin));
+            }
+        }
+
+        auto Resolve(const Entries::Form& a_form) -> std::uint32_t
+        {
+            auto it = plugins.find(a_form.modName);
+            if (it == plugins.end()) {
+                it = Add(a_form.modName);
+            }
+
+            const auto [light, index] = it->second;
+            return light ? 0xFE000000U | (index << 12) | (a_form.formID & 0xFFFU) : (index << 24) | (a_form.formID & 0xFFFFFFU);
+        }
+    private:
+        auto Add(std::string a_plugin) -> std::unordered_map<std::string, std::pair<bool, std::uint32_t>>::iterator
+        {
+            const auto light = a_plugin.ends_with(".esl");
+            const auto index = light ? lightCount++ : fullCount++;
+            return plugins.try_emplace(std::move(a_plugin), light, index).first;
+        }
+
+        std::unordered_map<std::string, std::pair<bool, std::uint32_t>> plugins;
+        std::uint32_t fullCount{ 0 };
+        std::uint32_t lightCount{ 0 };
+    };
+
+    // Stand-ins for BGSLocation / TESQuest and System::Quest with only what the headers read.
+    struct Location
+    {
+        Location* parentLoc;
+        std::uint32_t formID;
+    };
+
+    struct Owner
+    {
+        std::uint32_t formID;
+    };
+
+    struct Quest
+    {
+        Owner* quest;
+        Location* location;
+        Location* region;
+        Tables::TYPE type;
+        Tables::DIFFICULTY difficulty;
+        std::string name;
+        std::uint16_t objectiveIndex{ 0 };
+        std::uint32_t note{ 0 };
+    };
+
+    struct Tracker
+    {
+        Location* region;
+        std::array<std::uint32_t, 7> completed;
+    };
+
+    // What the session did, for the report and the tests.
+    struct Counters
+    {
+        std::uint64_t events{ 0 };
+        std::uint64_t unknownForms{ 0 };
+        std::uint64_t offered{ 0 };
+        std::uint64_t queued{ 0 };
+        std::uint64_t started{ 0 };
+        std::uint64_t completed{ 0 };
+        std::uint64_t rewarded{ 0 };
+    };
+
+    class Session
+    {
+    public:
+        // Dynamic forms start here; notes are the only ones the plugin creates.
+        static constexpr std::uint32_t NoteBase{ 0xFF000800 };
+
+        Session(std::span<const Entries::Quest> a_quests, std::span<const Entries::Reward> a_rewards, std::span<const Entries::Tracker> a_trackers, LoadOrder a_loadOrder, std::span<const double> a_weights, std::uint64_t a_seed)
+        {
+            // Regions are their locations' parents here: the config names no deeper hierarchy.
+            for (const auto& entry : a_quests) {
+                if (!Entries::IsValid(entry)) {
+                    continue;
+                }
+
+                const auto region = GetLocation(a_loadOrder.Resolve(entry.region), nullptr);
+                const auto location = GetLocation(a_loadOrder.Resolve(entry.location), region);
+                const auto owner = GetOwner(a_loadOrder.Resolve(entry.quest));
+
+                catalogue.Add(std::make_shared<Quest>(owner, location, region, Tables::GetType(entry.type), Tables::GetDifficulty(entry.difficulty), entry.name));
+            }
+
+            catalogue.BuildSamplers(a_weights);
+            weights.assign(a_weights.begin(), a_weights.end());
+            random.Seed(a_seed);
+
+            for (const auto& entry : a_rewards) {
+                auto& amount = rewards.emplace_back();
+                for (const auto& [difficulty, quantity] : entry.amount) {
+                    if (const auto index = static_cast<std::size_t>(difficulty); index < amount.size()) {
+                        amount[index] = quantity;
+                    }
+                }
+            }
+
+            for (const auto& entry : a_trackers) {
+                if (Entries::IsValid(entry)) {
+                    trackers.Add(std::make_shared<Tracker>(GetLocation(a_loadOrder.Resolve(entry.region), nullptr), std::array<std::uint32_t, 7>{}));
+                }
+            }
+        }
+
+        void Apply(const Recording::Record& a_record)
+        {
+            using Event = Recording::Event;
+
+            counters.events++;
+
+            const auto value = [&a_record](std::size_t a_index) -> std::uint64_t { return a_index < a_record.values.size() ? a_record.values[a_index] : 0; };
+
+            switch (a_record.event) {
+            case Event::MenuOpenClose:
+                if (value(0) == static_cast<std::uint64_t>(Recording::Menu::GiftMenu) && !value(1)) {
+                    StartQuests();
+                } else if (value(0) == static_cast<std::uint64_t>(Recording::Menu::DialogueMenu) && value(1) && current) {
+                    currentMask = catalogue.GetLocationMask(current);
+                }
+                break;
+            case Event::LocationChange:
+                if (current = FindLocation(value(0)); current) {
+                    currentMask = catalogue.GetLocationMask(current);
+                    trackers.FindRegion(current);
+                }
+                break;
+            case Event::ContainerChanged:
+                if (const auto it = notes.find(static_cast<std::uint32_t>(value(0))); it != notes.end()) {
+                    queue.push_back(it->second);
+                    counters.queued++;
+                }
+                break;
+            case Event::ShowMenu:
+                if (const auto region = FindLocation(value(0)); region) {
+                    for (const auto& quest : GetQuests(region, static_cast<Tables::TYPE>(value(1)))) {
+                        if (!reservations.Contains(quest->location)) {
+                            GetNote(quest);
+                            counters.offered++;
+                        }
+                    }
+                }
+                break;
+            case Event::StartEveryQuest:
+                if (const auto region = FindLocation(value(0)); region) {
+                    for (const auto& quest : GetQuests(region, static_cast<Tables::TYPE>(value(1)))) {
+                        if (!reservations.Contains(quest->location)) {
+                            queue.push_back(quest);
+                            counters.queued++;
+                        }
+                    }
+                    StartQuests();
+                }
+                break;
+            case Event::StartRandomQuest:
+                if (const auto region = FindLocation(value(0)); region) {
+                    if (auto quest = SelectQuest(region, static_cast<Tables::TYPE>(value(1))); quest) {
+                        queue.push_back(std::move(quest));
+                        counters.queued++;
+                        StartQuests();
+                    }
+                }
+                break;
+            case Event::RewardPlayer:
+                if (const auto region = FindLocation(value(0)); region) {
+                    if (const auto tracker = trackers.Find(region); tracker) {
+                        for (const auto& amount : rewards) {
+                            counters.rewarded += Store::GetRewardQuantity(amount, tracker->completed);
+                        }
+                        tracker->completed = {};
+                    }
+                }
+                break;
+            case Event::UpdateReward:
+                UpdateReward(static_cast<std::uint32_t>(value(0)), static_cast<std::uint16_t>(value(1)));
+                break;
+            }
+        }
+
+        auto GetCounters() const -> const Counters& { return counters; }
+        auto GetCurrentMask() const -> std::uint32_t { return currentMask; }
+        auto GetNoteCount() const -> std::size_t { return notes.size(); }
+        auto GetObjectives() const -> const std::vector<std::shared_ptr<Store::Objective<Owner, Location>>>& { return objectives.GetObjectives(); }
+        auto GetReservations() const -> const std::vector<Location*>& { return reservations.GetLocations(); }
+        auto GetTrackers() const -> const std::vector<std::shared_ptr<Tracker>>& { return trackers.GetTrackers(); }
+    private:
+        auto FindLocation(std::uint64_t a_formID) -> Location*
+        {
+            const auto it = locations.find(static_cast<std::uint32_t>(a_formID));
+            if (it == locations.end()) {
+                counters.unknownForms++;
+                return nullptr;
+            }
+            return it->second;
+        }
+
+        auto GetLocation(std::uint32_t a_formID, Location* a_parent) -> Location*
+        {
+            auto [it, inserted] = locations.try_emplace(a_formID, nullptr);
+            if (inserted) {
+                it->second = &locationStorage.emplace_back(a_parent, a_formID);
+            } else if (!it->second->parentLoc && a_parent != it->second) {
+                it->second->parentLoc = a_parent;
+            }
+            return it->second;
+        }
+
+        auto GetNote(const std::shared_ptr<Quest>& a_quest) -> std::uint32_t
+        {
+            if (!a_quest->note) {
+                a_quest->note = NoteBase + static_cast<std::uint32_t>(notes.size());
+                notes.try_emplace(a_quest->note, a_quest);
+            }
+            return a_quest->note;
+        }
+
+        auto GetOwner(std::uint32_t a_formID) -> Owner*
+        {
+            auto [it, inserted] = owners.try_emplace(a_formID, nullptr);
+            if (inserted) {
+                it->second = &ownerStorage.emplace_back(a_formID);
+            }
+            return it->second;
+        }
+
+        auto GetQuests(Location* a_region, Tables::TYPE a_type) const -> const Catalogue::Index<Quest>::List&
+        {
+            return a_type == Tables::TYPE::None ? catalogue.GetQuests(a_region) : catalogue.GetQuests(a_region, a_type);
+        }
+
+        // System::StartRandomQuest: draw up front, then reject reserved draws and fall back to a
+        // reservoir pass on a generator seeded from the shared one.
+        auto SelectQuest(Location* a_region, Tables::TYPE a_type) -> std::shared_ptr<Quest>
+        {
+            const auto& candidates = GetQuests(a_region, a_type);
+            const auto sampler = catalogue.GetSampler(a_region, a_type);
+
+            if (candidates.empty() || !sampler || (!sampler->IsEmpty() && sampler->GetSize() != candidates.size())) {
+                return nullptr;
+            }
+
+            std::array<std::size_t, 16> draws{};
+            std::size_t drawn = 0;
+
+            if (!sampler->IsEmpty()) {
+                for (auto& draw : draws) {
+                    draw = sampler->Sample(random);
+                }
+                drawn = draws.size();
+            }
+
+            Random::PCG32 fallback;
+            const auto seed = (static_cast<std::uint64_t>(random.Next()) << 32) | random.Next();
+            fallback.Seed(seed);
+
+            for (std::size_t attempt = 0; attempt < drawn; attempt++) {
+                const auto& quest = candidates[draws[attempt]];
+                if (!reservations.Contains(quest->location)) {
+                    return quest;
+                }
+            }
+
+            std::shared_ptr<Quest> selected;
+            double total = 0.0;
+
+            for (const auto& quest : candidates) {
+                const auto index = static_cast<std::size_t>(quest->difficulty);
+                const auto weight = index < weights.size() ? weights[index] : 0.0;
+                if (weight <= 0.0 || reservations.Contains(quest->location)) {
+                    continue;
+                }
+
+                total += weight;
+                if (fallback.NextDouble() * total < weight) {
+                    selected = quest;
+                }
+            }
+
+            return selected;
+        }
+
+        // System::StartQuests without the alias search: reserve, then store the objective text.
+        void StartQuests()
+        {
+            std::unordered_set<Quest*> started;
+
+            for (const auto& quest : queue) {
+                if (!started.insert(quest.get()).second || reservations.Contains(quest->location)) {
+                    continue;
+                }
+
+                std::uint16_t index = 1;
+                while (objectives.Find(quest->quest, index)) {
+                    index++;
+                }
+
+                reservations.Insert(quest->location);
+                objectives.Store(quest->quest, quest->location, index, quest->name);
+                quest->objectiveIndex = index;
+                counters.started++;
+            }
+
+            queue.clear();
+        }
+
+        // System::UpdateReward: the objective names the location, which names the catalogue quest.
+        void UpdateReward(std::uint32_t a_owner, std::uint16_t a_index)
+        {
+            const auto owner = owners.find(a_owner);
+            if (owner == owners.end()) {
+                counters.unknownForms++;
+                return;
+            }
+
+            const auto objective = objectives.Find(owner->second, a_index);
+            const auto quest = objective ? catalogue.GetQuest(owner->second, objective->location) : nullptr;
+
+            if (quest && quest->objectiveIndex == a_index) {
+                reservations.Erase(quest->location);
+
+                if (const auto tracker = trackers.Find(quest->region); tracker) {
+                    tracker->completed[static_cast<std::size_t>(quest->difficulty)]++;
+                }
+
+                counters.completed++;
+            }
+        }
+
+        std::deque<Location> locationStorage;
+        std::deque<Owner> ownerStorage;
+        std::unordered_map<std::uint32_t, Location*> locations;
+        std::unordered_map<std::uint32_t, Owner*> owners;
+        std::unordered_map<std::uint32_t, std::shared_ptr<Quest>> notes;
+        std::vector<std::shared_ptr<Quest>> queue;
+        std::vector<double> weights;
+        std::vector<std::array<std::uint32_t, 7>> rewards;
+        Catalogue::Index<Quest> catalogue;
+        Store::Reservations<Location> reservations;
+        Store::Objectives<Owner, Location> objectives;
+        Store::Trackers<Tracker> trackers;
+        Random::PCG32 random;
+        Location* current{ nullptr };
+        std::uint32_t currentMask{ 0 };
+        Counters counters;
+    };
+}
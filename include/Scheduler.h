@@ -0,0 +1,73 @@
+#pragma once
+
+class Scheduler
+{
+public:
+    // A Job polls its token and is asked to stop when the same key is enqueued again while it runs.
+    // A Callback cannot stop early; a newer one is queued behind it instead.
+    using Job = std::function<void(std::stop_token)>;
+    using Callback = std::function<void()>;
+
+    struct Stats
+    {
+        std::size_t depth;
+        std::uint64_t completed;
+        std::uint64_t coalesced;
+        std::uint64_t cancelled;
+        std::uint64_t dropped;
+        std::chrono::microseconds averageWait;
+        std::chrono::microseconds maxWait;
+        std::chrono::microseconds averageRun;
+        std::chrono::microseconds maxRun;
+    };
+
+    static Scheduler* GetSingleton()
+    {
+        static Scheduler singleton;
+        return &singleton;
+    }
+
+    bool Enqueue(std::string a_key, Job a_job);
+    bool Enqueue(std::string a_key, Callback a_callback);
+    auto GetStats() const -> Stats;
+private:
+    struct Task
+    {
+        std::string key;
+        Job job;
+        bool cancellable;
+        std::chrono::steady_clock::time_point queued;
+    };
+
+    Scheduler();
+    Scheduler(const Scheduler&) = delete;
+    Scheduler(Scheduler&&) = delete;
+
+    ~Scheduler() = default;
+
+    Scheduler& operator=(const Scheduler&) = delete;
+    Scheduler& operator=(Scheduler&&) = delete;
+
+    bool Enqueue(std::string a_key, Job a_job, bool a_cancellable);
+    void Run(std::stop_token a_token);
+
+    static constexpr std::size_t kCapacity{ 64 };
+
+    mutable std::mutex lock;
+    std::condition_variable_any condition;
+    std::deque<Task> tasks;
+    std::string runningKey;
+    bool runningCancellable{ false };
+    std::stop_source runningSource;
+
+    std::uint64_t completed{ 0 };
+    std::uint64_t coalesced{ 0 };
+    std::uint64_t cancelled{ 0 };
+    std::uint64_t dropped{ 0 };
+    std::chrono::microseconds totalWait{ 0 };
+    std::chrono::microseconds maxWait{ 0 };
+    std::chrono::microseconds totalRun{ 0 };
+    std::chrono::microseconds maxRun{ 0 };
+
+    std::jthread worker;
+};
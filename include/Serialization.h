@@ -1,5 +1,8 @@
 #pragma once
 
+#include "Binary.h"
+#include "Records.h"
+#include "Store.h"
 #include "Util.h"
 
 class Serialization
@@ -8,19 +11,14 @@ public:
 
     enum : std::uint32_t
     {
-        kVersion = 1,
+        kVersion = 2,
         kReservedLocations = 'RLOC',
         kObjectives = 'OBJS',
-        kTrackers = 'TRCS'
+        kTrackers = 'TRCS',
+        kRandom = 'RAND'
     };
 
-    struct Objective
-    {
-        RE::TESQuest* quest;
-        RE::BGSLocation* location;
-        std::uint16_t index;
-        std::string text;
-    };
+    using Objective = Store::Objective<RE::TESQuest, RE::BGSLocation>;
 
     struct Tracker
     {
@@ -37,25 +35,28 @@ public:
 
     void AddTracker(RE::TESGlobal* a_global, RE::BGSLocation* a_region);
     void ClearTracker(RE::BGSLocation* a_region);
-    void DeserializeObjectivesText(RE::TESQuest* a_quest, RE::BGSLocation* a_location, std::uint16_t a_index, std::string a_text);
+    void DeserializeObjectivesText(const std::vector<Objective>& a_objectives);
+    auto GetObjective(RE::TESQuest* a_quest, std::uint16_t a_index) const -> std::shared_ptr<Objective>;
+    auto GetTracker(RE::BGSLocation* a_region) const -> std::shared_ptr<Tracker>;
+    auto GetTrackerRegion(RE::BGSLocation* a_location) -> RE::BGSLocation*;
     auto GetTrackers() const -> const std::vector<std::shared_ptr<Tracker>>&;
     bool IsLocationReserved(RE::BGSLocation* a_location) const;
-    bool IsObjectiveSerialized(RE::BGSLocation* a_location) const;
+    bool IsObjectiveSerialized(RE::TESQuest* a_quest, RE::BGSLocation* a_location) const;
     bool IsTrackerSerialized(RE::TESGlobal* a_global) const;
-    bool ReadString(SKSE::SerializationInterface* a_interface, std::string& a_string) const;
     void ReserveLocation(RE::BGSLocation* a_location, bool a_reserve);
     void SerializeObjectivesText(RE::TESQuest* a_quest, RE::BGSLocation* a_location, std::uint16_t a_index, std::string a_text);
     void SetTracker(RE::BGSLocation* a_region, Util::DIFFICULTY a_difficulty, std::uint32_t a_amount);
     bool UpdateTracker(RE::TESGlobal* a_global, RE::BGSLocation* a_region, std::unordered_map<Util::DIFFICULTY, std::uint32_t>& a_reward);
-    bool WriteString(SKSE::SerializationInterface* a_interface, const std::string& a_string) const;
 
     static bool SaveObjectives(SKSE::SerializationInterface* a_interface);
     static bool SaveLocations(SKSE::SerializationInterface* a_interface);
     static bool SaveTrackers(SKSE::SerializationInterface* a_interface);
+    static bool SaveRandom(SKSE::SerializationInterface* a_interface);
 
-    static bool LoadObjectives(SKSE::SerializationInterface* a_interface);
-    static bool LoadLocations(SKSE::SerializationInterface* a_interface);
-    static bool LoadTrackers(SKSE::SerializationInterface* a_interface);
+    static bool LoadObjectives(SKSE::SerializationInterface* a_interface, std::uint32_t a_version, std::uint32_t a_length);
+    static bool LoadLocations(SKSE::SerializationInterface* a_interface, std::uint32_t a_version, std::uint32_t a_length);
+    static bool LoadTrackers(SKSE::SerializationInterface* a_interface, std::uint32_t a_version, std::uint32_t a_length);
+    static bool LoadRandom(SKSE::SerializationInterface* a_interface, std::uint32_t a_length);
 
     static void OnGameLoaded(SKSE::SerializationInterface*);
     static void OnGameSaved(SKSE::SerializationInterface*);
@@ -70,8 +71,10 @@ private:
     Serialization& operator=(const Serialization&) = delete;
     Serialization& operator=(Serialization&&) = delete;
 
+    static bool WriteRecord(SKSE::SerializationInterface* a_interface, std::uint32_t a_type, const Binary::Writer& a_writer);
+
     mutable std::mutex lock;
-    std::vector<std::shared_ptr<Objective>> objectives;
-    std::vector<RE::BGSLocation*> reservedLocations;
-    std::vector<std::shared_ptr<Tracker>> trackers;
+    Store::Objectives<RE::TESQuest, RE::BGSLocation> objectives;
+    Store::Reservations<RE::BGSLocation> reservations;
+    Store::Trackers<Tracker> trackers;
 };
@@ -0,0 +1,52 @@
+#pragma once
+
+class Settings
+{
+public:
+    struct Diagnostics
+    {
+        bool record{ false };
+        bool stats{ false };
+    };
+
+    struct Logging
+    {
+        spdlog::level::level_enum level{ spdlog::level::info };
+        // Off by default: the async queue drops the oldest messages when it overruns, which DumpStats reports.
+        bool async{ false };
+        std::size_t queueSize{ 8192 };
+        std::chrono::seconds flushInterval{ 3 };
+    };
+
+    struct Selection
+    {
+        std::array<double, 7> weights{ 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+        std::uint64_t seed{ 0 };
+    };
+
+    static Settings* GetSingleton()
+    {
+        static Settings singleton;
+        return &singleton;
+    }
+
+    auto GetDiagnostics() const -> const Diagnostics&;
+    auto GetError() const -> const std::string&;
+    auto GetLogging() const -> const Logging&;
+    auto GetSelection() const -> const Selection&;
+    void Load();
+private:
+    Settings() = default;
+    Settings(const Settings&) = delete;
+    Settings(Settings&&) = delete;
+
+    ~Settings() = default;
+
+    Settings& operator=(const Settings&) = delete;
+    Settings& operator=(Settings&&) = delete;
+
+    Diagnostics diagnostics;
+    std::string error;
+    Logging logging;
+    Selection selection;
+};
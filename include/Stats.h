@@ -0,0 +1,92 @@
+#pragma once
+
+class Stats
+{
+public:
+    enum class Metric : std::uint8_t
+    {
+        RewardPlayer,
+        ShowMenu,
+        StartEveryQuest,
+        StartRandomQuest,
+        UpdateReward,
+        StartQuests,
+        MenuOpenCloseEvent,
+        TESActorLocationChangeEvent,
+        TESContainerChangedEvent,
+        TESDeathEvent,
+        Total
+    };
+
+    // Times the enclosing block. Costs a single relaxed load when stats are disabled.
+    class Scope
+    {
+    public:
+        explicit Scope(Metric a_metric) :
+            metric(a_metric),
+            active(GetSingleton()->IsEnabled())
+        {
+            if (active) {
+                start = std::chrono::steady_clock::now();
+            }
+        }
+
+        Scope(const Scope&) = delete;
+        Scope(Scope&&) = delete;
+
+        ~Scope()
+        {
+            if (active) {
+                GetSingleton()->Record(metric, std::chrono::steady_clock::now() - start);
+            }
+        }
+
+        Scope& operator=(const Scope&) = delete;
+        Scope& operator=(Scope&&) = delete;
+    private:
+        Metric metric;
+        bool active;
+        std::chrono::steady_clock::time_point start;
+    };
+
+    static Stats* GetSingleton()
+    {
+        static Stats singleton;
+        return &singleton;
+    }
+
+    auto Dump() const -> std::optional<std::filesystem::path>;
+    bool IsEnabled() const { return enabled.load(std::memory_order_relaxed); }
+    void Record(Metric a_metric, std::chrono::nanoseconds a_duration);
+    void SetEnabled(bool a_enabled);
+private:
+    // Log-linear buckets: the power of two of the duration in nanoseconds, split into four
+    // sub-buckets, so percentiles are accurate to within 25% without storing samples.
+    static constexpr std::size_t kSubBuckets{ 4 };
+    static constexpr std::size_t kBuckets{ 65 * kSubBuckets };
+
+    struct Histogram
+    {
+        std::atomic<std::uint64_t> count{ 0 };
+        std::atomic<std::uint64_t> total{ 0 };
+        std::atomic<std::uint64_t> max{ 0 };
+        std::array<std::atomic<std::uint64_t>, kBuckets> buckets{};
+    };
+
+    Stats() = default;
+    Stats(const Stats&) = delete;
+    Stats(Stats&&) = delete;
+
+    ~Stats() = default;
+
+    Stats& operator=(const Stats&) = delete;
+    Stats& operator=(Stats&&) = delete;
+
+    static auto GetBucket(std::uint64_t a_value) -> std::size_t;
+    static auto GetBucketLimit(std::size_t a_bucket) -> std::uint64_t;
+    static auto GetName(Metric a_metric) -> std::string_view;
+    static auto GetPercentile(const Histogram& a_histogram, std::uint64_t a_count, double a_percentile) -> std::uint64_t;
+
+    std::atomic<bool> enabled{ false };
+    std::array<Histogram, static_cast<std::size_t>(Metric::Total)> histograms;
+};
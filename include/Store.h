@@ -0,0 +1,176 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+// Per-save state behind Serialization: reserved locations, stored objective texts and reward
+// trackers. Templated on the form types so the host-side tests can drive them with stand-ins. Nothing here
+// locks; Serialization guards it with its own mutex.
+namespace Store
+{
+    struct PairHash
+    {
+        template <class T, class U>
+        std::size_t operator()(const std::pair<T, U>& a_pair) const
+        {
+            return std::hash<T>()(a_pair.first) ^ (std::hash<U>()(a_pair.second) * 31);
+        }
+    };
+
+    // Set of reserved locations that also remembers insertion order, which is what gets saved.
+    template <class Location>
+    class Reservations
+    {
+    public:
+        void Clear()
+        {
+            order.clear();
+            set.clear();
+        }
+
+        bool Contains(Location* a_location) const { return set.contains(a_location); }
+
+        bool Erase(Location* a_location)
+        {
+            if (!set.erase(a_location)) {
+                return false;
+            }
+            order.erase(std::find(order.begin(), order.end(), a_location));
+            return true;
+        }
+
+        auto GetLocations() const -> const std::vector<Location*>& { return order; }
+
+        bool Insert(Location* a_location)
+        {
+            if (!set.insert(a_location).second) {
+                return false;
+            }
+            order.push_back(a_location);
+            return true;
+        }
+    private:
+        std::vector<Location*> order;
+        std::unordered_set<Location*> set;
+    };
+
+    template <class Quest, class Location>
+    struct Objective
+    {
+        Quest* quest;
+        Location* location;
+        std::uint16_t index;
+        std::string text;
+    };
+
+    // Objective texts indexed by (quest, location) for storing and by (quest, index) for lookups
+    // from UpdateReward, so both directions stay O(1) however many objectives a save carries.
+    template <class Quest, class Location>
+    class Objectives
+    {
+    public:
+        using Entry = Objective<Quest, Location>;
+
+        void Clear()
+        {
+            objectives.clear();
+            byLocation.clear();
+            byIndex.clear();
+        }
+
+        bool Contains(Quest* a_quest, Location* a_location) const { return byLocation.contains({ a_quest, a_location }); }
+
+        auto Find(Quest* a_quest, std::uint16_t a_index) const -> std::shared_ptr<Entry>
+        {
+            const auto it = byIndex.find({ a_quest, a_index });
+            return it != byIndex.end() ? it->second : nullptr;
+        }
+
+        auto GetObjectives() const -> const std::vector<std::shared_ptr<Entry>>& { return objectives; }
+
+        void Store(Quest* a_quest, Location* a_location, std::uint16_t a_index, std::string a_text)
+        {
+            auto [it, inserted] = byLocation.try_emplace({ a_quest, a_location });
+
+            if (inserted) {
+                it->second = std::make_shared<Entry>(a_quest, a_location, a_index, std::move(a_text));
+                objectives.push_back(it->second);
+            } else {
+                if (const auto previous = byIndex.find({ a_quest, it->second->index }); previous != byIndex.end() && previous->second == it->second) {
+                    byIndex.erase(previous);
+                }
+                it->second->index = a_index;
+                it->second->text = std::move(a_text);
+            }
+
+            byIndex.insert_or_assign({ a_quest, a_index }, it->second);
+        }
+    private:
+        std::vector<std::shared_ptr<Entry>> objectives;
+        std::unordered_map<std::pair<Quest*, Location*>, std::shared_ptr<Entry>, PairHash> byLocation;
+        std::unordered_map<std::pair<Quest*, std::uint16_t>, std::shared_ptr<Entry>, PairHash> byIndex;
+    };
+
+    // Reward trackers keyed by region. Tracker must expose a region pointer whose type exposes
+    // parentLoc; FindRegion caches which tracked region, if any, encloses a location.
+    template <class Tracker>
+    class Trackers
+    {
+    public:
+        using Location = std::remove_pointer_t<decltype(Tracker::region)>;
+
+        void Add(std::shared_ptr<Tracker> a_tracker)
+        {
+            byRegion.try_emplace(a_tracker->region, a_tracker);
+            trackers.push_back(std::move(a_tracker));
+            regions.clear();
+        }
+
+        auto Find(Location* a_region) const -> std::shared_ptr<Tracker>
+        {
+            const auto it = byRegion.find(a_region);
+            return it != byRegion.end() ? it->second : nullptr;
+        }
+
+        auto FindRegion(Location* a_location) -> Location*
+        {
+            if (const auto it = regions.find(a_location); it != regions.end()) {
+                return it->second;
+            }
+
+            Location* result = nullptr;
+            for (auto currentLocation = a_location; currentLocation && !result; currentLocation = currentLocation->parentLoc) {
+                if (byRegion.contains(currentLocation)) {
+                    result = currentLocation;
+                }
+            }
+
+            regions.try_emplace(a_location, result);
+            return result;
+        }
+
+        auto GetTrackers() const -> const std::vector<std::shared_ptr<Tracker>>& { return trackers; }
+    private:
+        std::vector<std::shared_ptr<Tracker>> trackers;
+        std::unordered_map<Location*, std::shared_ptr<Tracker>> byRegion;
+        std::unordered_map<Location*, Location*> regions;
+    };
+
+    // Reward owed for a tracker: the per-difficulty amount times the quests completed at that difficulty.
+    inline auto GetRewardQuantity(const std::array<std::uint32_t, 7>& a_amount, const std::array<std::uint32_t, 7>& a_completed) -> std::uint32_t
+    {
+        std::uint32_t quantity = 0U;
+        for (std::size_t i = 0; i < a_amount.size(); i++) {
+            quantity += a_amount[i] * a_completed[i];
+        }
+        return quantity;
+    }
+}
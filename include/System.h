@@ -1,5 +1,10 @@
 #pragma once
 
+#include "Catalogue.h"
+#include "Queue.h"
+#include "Random.h"
+#include "Template.h"
+#include "Config.h"
 #include "Util.h"
 
 class System
@@ -16,13 +21,21 @@ public:
         RE::TESObjectBOOK* note;
         std::vector<RE::FormID> bossList;
         std::uint16_t objectiveIndex;
+        std::string label;
     };
 
     struct Reward
     {
         RE::FormID formID;
         std::string modName;
-        std::unordered_map<Util::DIFFICULTY, std::uint32_t> amount;
+        RE::TESBoundObject* form;
+        std::array<std::uint32_t, 7> amount;
+    };
+
+    struct Boss
+    {
+        bool alive;
+        float day;
     };
 
     static System* GetSingleton()
@@ -32,24 +45,42 @@ public:
     }
 
     void AddToQueue(std::shared_ptr<Quest> a_quest);
+    void BuildIndex();
     auto CreateNote(std::string a_name, std::string a_difficulty) -> RE::TESObjectBOOK*;
     void CompleteObjective(RE::BGSLocation* a_region, std::uint16_t a_index);
+    void FormatObjective(std::string& a_buffer, const Quest& a_quest, std::uint16_t a_index) const;
     auto GetAliasReference(RE::TESQuest* a_quest, std::uint32_t a_index) -> RE::BGSBaseAlias*;
+    auto GetBossCounters() const -> std::pair<std::uint64_t, std::uint64_t>;
     auto GetMapMarker(RE::BGSLocation* a_location) -> RE::TESObjectREFR*;
+    auto GetNote(const std::shared_ptr<Quest>& a_quest) -> RE::TESObjectBOOK*;
+    auto GetNoteCounts() const -> std::pair<std::size_t, std::size_t>;
+    auto GetQuest(RE::TESQuest* a_owner, RE::BGSLocation* a_location) const -> std::shared_ptr<Quest>;
+    auto GetQuestByNote(RE::FormID a_note) const -> std::shared_ptr<Quest>;
     auto GetQuests() const -> const std::vector<std::shared_ptr<Quest>>&;
+    auto GetQuests(RE::BGSLocation* a_region) const -> const std::vector<std::shared_ptr<Quest>>&;
+    auto GetQuests(RE::BGSLocation* a_region, Util::TYPE a_type) const -> const std::vector<std::shared_ptr<Quest>>&;
+    auto GetRandomState() const -> Random::PCG32::State;
+    void InvalidateBoss(RE::Actor* a_actor);
+    bool IsBossAlive(RE::BGSLocation* a_location, RE::BGSLocationRefType* a_type);
+    bool IsOwner(RE::TESQuest* a_quest) const;
+    void ParseGlobals();
     void ParseQuests();
     void ParseRewards();
     void ParseTrackers();
     void ParseTexts();
     void PopulateMenu(RE::BGSLocation* a_region, Util::TYPE a_type);
+    void ReloadQuests();
+    void Revert();
     void RewardPlayer(RE::BGSLocation* a_region);
+    void SetRandomState(const Random::PCG32::State& a_state);
     void ShowGiftMenu(RE::TESObjectREFR* a_target, RE::TESObjectREFR* a_source);
     void StartEveryQuest(RE::BGSLocation* a_region, Util::TYPE a_type);
     static void StartQuests();
     void StartRandomQuest(RE::BGSLocation* a_region, Util::TYPE a_type);
-    void UpdateGlobals();
-    static void UpdateLocationAlias(RE::TESQuest* a_quest, RE::BGSLocation* a_location);
+    void UpdateGlobals(RE::BGSLocation* a_location);
+    static void UpdateLocationAlias(RE::TESQuest* a_quest, RE::BGSLocation* a_location, std::stop_token a_token = {});
     void UpdateReward(RE::TESQuest* a_quest, std::uint16_t a_index);
+    static bool WaitUntil(std::function<bool()> a_condition, std::chrono::milliseconds a_timeout, std::stop_token a_token = {});
 
     static void ForceLocationTo(RE::TESQuest* a_quest, std::uint32_t a_aliasID, RE::BGSLocation* a_location);
     static void ForceRefTo(RE::TESQuest* a_quest, std::uint32_t a_aliasID, RE::TESObjectREFR* a_reference);
@@ -66,7 +97,37 @@ private:
     System& operator=(const System&) = delete;
     System& operator=(System&&) = delete;
 
+    void CompileObjective(std::string_view a_text);
+    void ReleaseQuest(const std::shared_ptr<Quest>& a_quest);
+    void RemoveQuest(const Config::Quest& a_record, std::unordered_set<RE::BGSLocation*>& a_touched);
+    static auto ResolveQuest(const Config::Quest& a_record) -> std::shared_ptr<Quest>;
+    void SeedRandom();
+    void Supersede(const std::shared_ptr<Quest>& a_previous, const std::shared_ptr<Quest>& a_quest);
+
+    // Guards the quest catalogue and its indexes against ReloadQuests. Lock order is catalogueLock,
+    // then Serialization's lock, then randomLock, maskLock, noteLock or bossLock; never take
+    // catalogueLock while holding one of the others, and never call into Serialization while
+    // holding randomLock. GetQuests returns references into the catalogue, so callers hold it.
+    mutable std::shared_mutex catalogueLock;
+
     std::vector<Reward> rewards;
-    std::vector<std::shared_ptr<Quest>> quests;
-    std::vector<std::shared_ptr<Quest>> queue;
+    Catalogue::Index<Quest> catalogue;
+    MPSCQueue<std::shared_ptr<Quest>> queue;
+    std::array<RE::TESGlobal*, 12> globals{};
+    std::optional<std::uint32_t> currentMask;
+
+    // Serialises the catalogue's location mask cache between holders of the shared catalogueLock.
+    mutable std::mutex maskLock;
+    std::vector<Template::Token> objectiveTemplate;
+
+    mutable std::mutex randomLock;
+    Random::PCG32 random;
+
+    mutable std::mutex noteLock;
+    std::unordered_map<RE::FormID, std::shared_ptr<Quest>> notes;
+
+    mutable std::mutex bossLock;
+    std::unordered_map<RE::BGSLocation*, Boss> bosses;
+    std::uint64_t bossHits{ 0 };
+    std::uint64_t bossMisses{ 0 };
 };
\ No newline at end of file
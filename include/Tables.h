@@ -0,0 +1,107 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+// Catalogue enums and their name tables. Util re-exports these; they live here so code that
+// only needs the enums does not pull in RE:: headers.
+namespace Tables
+{
+    enum class TYPE : std::uint32_t
+    {
+        None = 0,
+        Bandit = 1,
+        Dragon = 2,
+        Draugr = 3,
+        Dwemer = 4,
+        Falmer = 5,
+        Forsworn = 6,
+        Giant = 7,
+        Mage = 8,
+        Reaver = 9,
+        Riekling = 10,
+        Vampire = 11
+    };
+
+    enum class DIFFICULTY : std::uint32_t
+    {
+        None = 0,
+        Novice = 1,
+        Apprentice = 2,
+        Adept = 3,
+        Expert = 4,
+        Master = 5,
+        Legendary = 6
+    };
+
+    enum class TEXT : std::uint32_t
+    {
+        Objective = 0,
+        Novice = 1,
+        Apprentice = 2,
+        Adept = 3,
+        Expert = 4,
+        Master = 5,
+        Legendary = 6
+    };
+
+    // Sorted by name so lookups can binary search; keys are lowercase and matched case-insensitively.
+    inline constexpr std::array<std::pair<std::string_view, DIFFICULTY>, 6> Difficulties{ {
+        { "adept", DIFFICULTY::Adept },
+        { "apprentice", DIFFICULTY::Apprentice },
+        { "expert", DIFFICULTY::Expert },
+        { "legendary", DIFFICULTY::Legendary },
+        { "master", DIFFICULTY::Master },
+        { "novice", DIFFICULTY::Novice }
+    } };
+
+    inline constexpr std::array<std::pair<std::string_view, TYPE>, 11> Types{ {
+        { "bandit", TYPE::Bandit },
+        { "dragon", TYPE::Dragon },
+        { "draugr", TYPE::Draugr },
+        { "dwemer", TYPE::Dwemer },
+        { "falmer", TYPE::Falmer },
+        { "forsworn", TYPE::Forsworn },
+        { "giant", TYPE::Giant },
+        { "mage", TYPE::Mage },
+        { "reaver", TYPE::Reaver },
+        { "riekling", TYPE::Riekling },
+        { "vampire", TYPE::Vampire }
+    } };
+
+    constexpr auto Compare(std::string_view a_lhs, std::string_view a_rhs) -> int
+    {
+        const auto lower = [](char c) { return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c; };
+
+        for (std::size_t i = 0; i < a_lhs.size() && i < a_rhs.size(); i++) {
+            if (const auto l = lower(a_lhs[i]), r = lower(a_rhs[i]); l != r) {
+                return l < r ? -1 : 1;
+            }
+        }
+        return a_lhs.size() == a_rhs.size() ? 0 : (a_lhs.size() < a_rhs.size() ? -1 : 1);
+    }
+
+    template <class T, std::size_t N>
+    constexpr auto Find(const std::array<std::pair<std::string_view, T>, N>& a_table, std::string_view a_string, T a_default) -> T
+    {
+        const auto it = std::lower_bound(a_table.begin(), a_table.end(), a_string, [](const auto& a_entry, std::string_view a_key) { return Compare(a_entry.first, a_key) < 0; });
+        return it != a_table.end() && Compare(it->first, a_string) == 0 ? it->second : a_default;
+    }
+
+    template <class T, std::size_t N>
+    constexpr auto GetName(const std::array<std::pair<std::string_view, T>, N>& a_table, T a_value) -> std::string_view
+    {
+        for (const auto& [name, value] : a_table) {
+            if (value == a_value) {
+                return name;
+            }
+        }
+        return "none";
+    }
+
+    constexpr auto GetDifficulty(std::string_view a_string) -> DIFFICULTY { return Find(Difficulties, a_string, DIFFICULTY::None); }
+    constexpr auto GetType(std::string_view a_string) -> TYPE { return Find(Types, a_string, TYPE::None); }
+}
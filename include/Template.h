@@ -0,0 +1,175 @@
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Objective text templates. Kept free of RE:: types so the parser and renderer can be built
+// and measured outside the game.
+namespace Template
+{
+    enum class Kind : std::uint8_t
+    {
+        Literal,
+        Difficulty,
+        Index,
+        Location,
+        Region,
+        Reward
+    };
+
+    struct Token
+    {
+        Kind kind;
+        std::string text;
+    };
+
+    // One configured reward at the quest's difficulty: the quantity and the form's display name.
+    struct Reward
+    {
+        std::uint32_t quantity;
+        std::string_view name;
+    };
+
+    struct Arguments
+    {
+        std::string_view difficulty;
+        std::uint16_t index;
+        std::string_view location;
+        std::string_view region;
+        std::span<const Reward> rewards;
+    };
+
+    inline void Append(std::vector<Token>& a_tokens, Kind a_kind, std::string_view a_literal = {})
+    {
+        if (a_kind == Kind::Literal && !a_tokens.empty() && a_tokens.back().kind == Kind::Literal) {
+            a_tokens.back().text.append(a_literal);
+        } else {
+            a_tokens.emplace_back(a_kind, std::string(a_literal));
+        }
+    }
+
+    inline bool Contains(const std::vector<Token>& a_tokens, Kind a_kind)
+    {
+        return std::ranges::any_of(a_tokens, [a_kind](const Token& a_token) { return a_token.kind == a_kind; });
+    }
+
+    // %d difficulty, %i zero-padded index, %l location, %r region, %a rewards, %% percent.
+    // Unknown placeholders are kept verbatim and reported through a_unknown.
+    inline auto Compile(std::string_view a_text, std::vector<std::string>& a_unknown) -> std::vector<Token>
+    {
+        std::vector<Token> tokens;
+        std::size_t position = 0;
+
+        while (position < a_text.size()) {
+            const auto marker = a_text.find('%', position);
+
+            if (marker == std::string_view::npos || marker + 1 >= a_text.size()) {
+                Append(tokens, Kind::Literal, a_text.substr(position));
+                break;
+            }
+
+            if (marker > position) {
+                Append(tokens, Kind::Literal, a_text.substr(position, marker - position));
+            }
+
+            switch (a_text[marker + 1]) {
+            case 'd':
+                Append(tokens, Kind::Difficulty);
+                break;
+            case 'i':
+                Append(tokens, Kind::Index);
+                break;
+            case 'l':
+                Append(tokens, Kind::Location);
+                break;
+            case 'r':
+                Append(tokens, Kind::Region);
+                break;
+            case 'a':
+                Append(tokens, Kind::Reward);
+                break;
+            case '%':
+                Append(tokens, Kind::Literal, "%");
+                break;
+            default:
+                a_unknown.emplace_back(a_text.substr(marker, 2));
+                Append(tokens, Kind::Literal, a_text.substr(marker, 2));
+                break;
+            }
+
+            position = marker + 2;
+        }
+
+        return tokens;
+    }
+
+    // Appends a_value in decimal, zero-padded to a_width digits.
+    inline void AppendNumber(std::string& a_buffer, std::uint32_t a_value, std::size_t a_width = 0)
+    {
+        char digits[10];
+        const auto end = std::to_chars(digits, digits + sizeof(digits), a_value).ptr;
+        const auto length = static_cast<std::size_t>(end - digits);
+
+        if (length < a_width) {
+            a_buffer.append(a_width - length, '0');
+        }
+        a_buffer.append(digits, length);
+    }
+
+    // Each reward with a non-zero quantity as "500 Gold", comma separated. Quantities of different
+    // forms are never added together.
+    inline void AppendRewards(std::string& a_buffer, std::span<const Reward> a_rewards)
+    {
+        bool first = true;
+
+        for (const auto& reward : a_rewards) {
+            if (!reward.quantity) {
+                continue;
+            }
+
+            if (!first) {
+                a_buffer.append(", ");
+            }
+            first = false;
+
+            AppendNumber(a_buffer, reward.quantity);
+            if (!reward.name.empty()) {
+                a_buffer.push_back(' ');
+                a_buffer.append(reward.name);
+            }
+        }
+    }
+
+    inline void Render(std::string& a_buffer, const std::vector<Token>& a_tokens, const Arguments& a_arguments)
+    {
+        a_buffer.clear();
+
+        for (const auto& token : a_tokens) {
+            switch (token.kind) {
+            case Kind::Literal:
+                a_buffer.append(token.text);
+                break;
+            case Kind::Difficulty:
+                a_buffer.append(a_arguments.difficulty);
+                break;
+            case Kind::Index:
+                AppendNumber(a_buffer, a_arguments.index, 2);
+                break;
+            case Kind::Location:
+                a_buffer.append(a_arguments.location);
+                break;
+            case Kind::Region:
+                a_buffer.append(a_arguments.region);
+                break;
+            case Kind::Reward:
+                AppendRewards(a_buffer, a_arguments.rewards);
+                break;
+            }
+        }
+    }
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#ifdef BQRNG_PROFILE
+
+// Scoped timing zones for the profile build. Each thread appends to its own buffer; Write()
+// merges them into a Chrome trace-event file (chrome://tracing, Perfetto) on every game save
+// and on BQRNG.DumpStats().
+class Trace
+{
+public:
+    class Zone
+    {
+    public:
+        explicit Zone(const char* a_name) :
+            name(a_name),
+            start(std::chrono::steady_clock::now())
+        {}
+
+        Zone(const Zone&) = delete;
+        Zone(Zone&&) = delete;
+
+        ~Zone() { GetSingleton()->Record(name, start, std::chrono::steady_clock::now()); }
+
+        Zone& operator=(const Zone&) = delete;
+        Zone& operator=(Zone&&) = delete;
+    private:
+        const char* name;
+        std::chrono::steady_clock::time_point start;
+    };
+
+    static Trace* GetSingleton()
+    {
+        static Trace singleton;
+        return &singleton;
+    }
+
+    void Record(const char* a_name, std::chrono::steady_clock::time_point a_start, std::chrono::steady_clock::time_point a_end);
+    auto Write() -> std::optional<std::filesystem::path>;
+private:
+    struct Event
+    {
+        const char* name;
+        std::chrono::nanoseconds start;
+        std::chrono::nanoseconds duration;
+    };
+
+    struct Buffer
+    {
+        std::uint32_t thread;
+        std::mutex lock;
+        std::vector<Event> events;
+    };
+
+    Trace() = default;
+    Trace(const Trace&) = delete;
+    Trace(Trace&&) = delete;
+
+    ~Trace() = default;
+
+    Trace& operator=(const Trace&) = delete;
+    Trace& operator=(Trace&&) = delete;
+
+    auto GetBuffer() -> Buffer&;
+
+    static constexpr std::size_t kCapacity{ 1 << 18 };
+
+    std::mutex lock;
+    std::vector<std::shared_ptr<Buffer>> buffers;
+    std::chrono::steady_clock::time_point origin{ std::chrono::steady_clock::now() };
+};
+
+#define PROFILE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_IMPL(a, b)
+#define PROFILE_ZONE(name) const Trace::Zone PROFILE_CONCAT(zone, __LINE__)(name)
+#define PROFILE_WRITE() Trace::GetSingleton()->Write()
+
+#else
+
+#define PROFILE_ZONE(name) static_cast<void>(0)
+#define PROFILE_WRITE() static_cast<void>(0)
+
+#endif
@@ -1,47 +1,17 @@
 #pragma once
 
 #include "Offsets.h"
+#include "Tables.h"
 
 class Util
 {
 public:
-    enum class TYPE : std::uint32_t
-    {
-        None = 0,
-        Bandit = 1,
-        Dragon = 2,
-        Draugr = 3,
-        Dwemer = 4,
-        Falmer = 5,
-        Forsworn = 6,
-        Giant = 7,
-        Mage = 8,
-        Reaver = 9,
-        Riekling = 10,
-        Vampire = 11
-    };
-
-    enum class DIFFICULTY : std::uint32_t
-    {
-        None = 0,
-        Novice = 1,
-        Apprentice = 2,
-        Adept = 3,
-        Expert = 4,
-        Master = 5,
-        Legendary = 6
-    };
+    using TYPE = Tables::TYPE;
+    using DIFFICULTY = Tables::DIFFICULTY;
+    using TEXT = Tables::TEXT;
 
-    enum class TEXT : std::uint32_t
-    {
-        Objective = 0,
-        Novice = 1,
-        Apprentice = 2,
-        Adept = 3,
-        Expert = 4,
-        Master = 5,
-        Legendary = 6
-    };
+    static constexpr const auto& Difficulties = Tables::Difficulties;
+    static constexpr const auto& Types = Tables::Types;
 
     static Util* GetSingleton()
     {
@@ -49,13 +19,19 @@ public:
         return &singleton;
     }
 
-    auto GetDifficulty(std::string a_string) -> DIFFICULTY;
-    auto GetDifficulty(Util::DIFFICULTY a_difficulty) -> std::string;
+    static constexpr auto GetDifficulty(std::string_view a_string) -> DIFFICULTY { return Tables::GetDifficulty(a_string); }
+    auto GetDifficulty(Util::DIFFICULTY a_difficulty) const -> std::string_view;
     auto GetLocation(RE::FormID a_formID, std::string a_modName) const -> RE::BGSLocation*;
     auto GetQuest(RE::FormID a_formID, std::string a_modName) const -> RE::TESQuest*;
-    auto GetText(Util::TEXT a_text) -> std::string;
-    auto GetType(std::string a_string) -> TYPE;
+    auto GetText(Util::TEXT a_text) const -> std::string_view;
+    static constexpr auto GetType(std::string_view a_string) -> TYPE { return Tables::GetType(a_string); }
     void SetText(Util::TEXT a_text, std::string a_string);
+
+    template <class T, std::size_t N>
+    static constexpr auto GetName(const std::array<std::pair<std::string_view, T>, N>& a_table, T a_value) -> std::string_view
+    {
+        return Tables::GetName(a_table, a_value);
+    }
 private:
     Util() = default;
     Util(const Util&) = delete;
@@ -66,5 +42,5 @@ private:
     Util& operator=(const Util&) = delete;
     Util& operator=(Util&&) = delete;
 
-    std::unordered_map<Util::TEXT, std::string> text;
+    std::array<std::string, 7> text;
 };
\ No newline at end of file
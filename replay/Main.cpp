@@ -0,0 +1,234 @@
+#include "Json.h"
+#include "Recording.h"
+#include "Replay.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    constexpr std::array<std::string_view, 8> EventNames{ "MenuOpenClose", "LocationChange", "ContainerChanged", "ShowMenu", "StartEveryQuest", "StartRandomQuest", "RewardPlayer", "UpdateReward" };
+
+    template <class T, class F>
+    auto ReadEntries(const std::filesystem::path& a_path, std::string_view a_root, F a_field) -> std::vector<T>
+    {
+        std::ifstream stream(a_path);
+        if (!stream) {
+            std::fprintf(stderr, "replay: skipping missing '%s'\n", a_path.string().c_str());
+            return {};
+        }
+        return Json::ReadEntries<T>(stream, a_root, std::move(a_field));
+    }
+
+    auto ReadLines(const std::filesystem::path& a_path) -> std::vector<std::string>
+    {
+        std::vector<std::string> lines;
+        std::ifstream stream(a_path);
+        for (std::string line; std::getline(stream, line);) {
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+            // plugins.txt marks enabled plugins with '*' and comments with '#'.
+            if (!line.empty() && line.front() == '*') {
+                line.erase(0, 1);
+            }
+            if (!line.empty() && line.front() != '#') {
+                lines.push_back(std::move(line));
+            }
+        }
+        return lines;
+    }
+
+    // Backslashes in Windows paths, quotes and control characters would otherwise break the report.
+    auto EscapeJson(std::string_view a_text) -> std::string
+    {
+        std::string result;
+        result.reserve(a_text.size());
+        for (const auto character : a_text) {
+            switch (character) {
+            case '"':
+                result += "\\\"";
+                break;
+            case '\\':
+                result += "\\\\";
+                break;
+            case '\n':
+                result += "\\n";
+                break;
+            case '\r':
+                result += "\\r";
+                break;
+            case '\t':
+                result += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(character) < 0x20) {
+                    char buffer[8];
+                    std::snprintf(buffer, sizeof(buffer), "\\u%04X", static_cast<unsigned>(static_cast<unsigned char>(character)));
+                    result += buffer;
+                } else {
+                    result += character;
+                }
+            }
+        }
+        return result;
+    }
+
+    auto GetPercentile(std::vector<std::uint64_t>& a_samples, double a_percentile) -> std::uint64_t
+    {
+        const auto index = static_cast<std::size_t>(a_percentile * static_cast<double>(a_samples.size() - 1));
+        std::nth_element(a_samples.begin(), a_samples.begin() + static_cast<std::ptrdiff_t>(index), a_samples.end());
+        return a_samples[index];
+    }
+}
+
+// Usage: replay <trace> [--config <directory>] [--plugins <plugins.txt>] [--seed <n>] > report.json.
+// Replays a Recorder trace against the config's quest packs, rewards and trackers and writes the
+// per-event latency and the final state to stdout. FormIDs in the trace are resolved through the
+// load order, so pass the tester's plugins.txt when it had more than the base game.
+int main(int a_argc, char* a_argv[])
+{
+    std::filesystem::path trace;
+    std::filesystem::path config{ "content/SKSE/Plugins/Bounty Quests Redone - NG" };
+    std::filesystem::path plugins;
+    std::uint64_t seed{ 1 };
+
+    for (int i = 1; i < a_argc; i++) {
+        const std::string_view argument = a_argv[i];
+
+        if (argument == "--config" && i + 1 < a_argc) {
+            config = a_argv[++i];
+        } else if (argument == "--plugins" && i + 1 < a_argc) {
+            plugins = a_argv[++i];
+        } else if (argument == "--seed" && i + 1 < a_argc) {
+            seed = std::strtoull(a_argv[++i], nullptr, 10);
+        } else if (trace.empty()) {
+            trace = argument;
+        } else {
+            std::fprintf(stderr, "replay: unexpected argument '%s'\n", a_argv[i]);
+            return 2;
+        }
+    }
+
+    if (trace.empty()) {
+        std::fprintf(stderr, "usage: replay <trace> [--config <directory>] [--plugins <plugins.txt>] [--seed <n>]\n");
+        return 2;
+    }
+
+    std::ifstream stream(trace, std::ios::binary);
+    if (!stream) {
+        std::fprintf(stderr, "replay: failed to open '%s'\n", trace.string().c_str());
+        return 1;
+    }
+
+    const std::vector<char> bytes{ std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>() };
+
+    std::vector<Recording::Record> records;
+    const auto complete = Recording::Decode(std::as_bytes(std::span(bytes)), records);
+
+    if (!complete && records.empty()) {
+        std::fprintf(stderr, "replay: '%s' is not a version %u trace\n", trace.string().c_str(), Recording::Version);
+        return 1;
+    }
+
+    std::vector<std::filesystem::path> files;
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(config / "Quests", error)) {
+        if (entry.path().extension() == ".json") {
+            files.push_back(entry.path());
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    std::vector<Entries::Quest> quests;
+    for (const auto& file : files) {
+        auto entries = ReadEntries<Entries::Quest>(file, "Quests", Entries::ReadQuest);
+        quests.insert(quests.end(), std::make_move_iterator(entries.begin()), std::make_move_iterator(entries.end()));
+    }
+
+    const auto rewards = ReadEntries<Entries::Reward>(config / "Rewards.json", "Rewards", Entries::ReadReward);
+    const auto trackers = ReadEntries<Entries::Tracker>(config / "Trackers.json", "Trackers", Entries::ReadTracker);
+
+    // Settings' default selection weights: every difficulty equally likely.
+    const std::array<double, 7> weights{ 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+
+    Replay::Session session(quests, rewards, trackers, plugins.empty() ? Replay::LoadOrder() : Replay::LoadOrder(ReadLines(plugins)), weights, seed);
+
+    std::array<std::vector<std::uint64_t>, EventNames.size()> samples;
+
+    for (const auto& record : records) {
+        const auto start = std::chrono::steady_clock::now();
+        session.Apply(record);
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+        samples[static_cast<std::size_t>(record.event)].push_back(static_cast<std::uint64_t>(elapsed.count()));
+    }
+
+    const auto& counters = session.GetCounters();
+
+    std::printf("{\n  \"trace\": \"%s\",\n  \"records\": %zu,\n  \"complete\": %s,\n  \"quests\": %zu,\n", EscapeJson(trace.string()).c_str(), records.size(), complete ? "true" : "false", quests.size());
+
+    std::printf("  \"events\": [\n");
+    bool first = true;
+    for (std::size_t i = 0; i < samples.size(); i++) {
+        auto& list = samples[i];
+        if (list.empty()) {
+            continue;
+        }
+
+        std::uint64_t total = 0;
+        for (const auto sample : list) {
+            total += sample;
+        }
+
+        const auto max = *std::max_element(list.begin(), list.end());
+        const auto p50 = GetPercentile(list, 0.50);
+        const auto p99 = GetPercentile(list, 0.99);
+
+        std::printf("%s    { \"event\": \"%s\", \"count\": %zu, \"mean_ns\": %.1f, \"p50_ns\": %llu, \"p99_ns\": %llu, \"max_ns\": %llu }", first ? "" : ",\n", EventNames[i].data(), list.size(), static_cast<double>(total) / static_cast<double>(list.size()), static_cast<unsigned long long>(p50), static_cast<unsigned long long>(p99), static_cast<unsigned long long>(max));
+        first = false;
+    }
+    std::printf("\n  ],\n");
+
+    std::printf("  \"state\": {\n");
+    std::printf("    \"unknown_forms\": %llu, \"offered\": %llu, \"queued\": %llu, \"started\": %llu, \"completed\": %llu, \"rewarded\": %llu,\n", static_cast<unsigned long long>(counters.unknownForms), static_cast<unsigned long long>(counters.offered), static_cast<unsigned long long>(counters.queued), static_cast<unsigned long long>(counters.started), static_cast<unsigned long long>(counters.completed), static_cast<unsigned long long>(counters.rewarded));
+    std::printf("    \"current_mask\": %u, \"notes\": %zu,\n", session.GetCurrentMask(), session.GetNoteCount());
+
+    std::printf("    \"reservations\": [");
+    const auto& reservations = session.GetReservations();
+    for (std::size_t i = 0; i < reservations.size(); i++) {
+        std::printf("%s\"0x%X\"", i ? ", " : "", reservations[i]->formID);
+    }
+    std::printf("],\n");
+
+    std::printf("    \"objectives\": [");
+    const auto& objectives = session.GetObjectives();
+    for (std::size_t i = 0; i < objectives.size(); i++) {
+        std::printf("%s{ \"quest\": \"0x%X\", \"location\": \"0x%X\", \"index\": %u }", i ? ", " : "", objectives[i]->quest->formID, objectives[i]->location->formID, static_cast<unsigned>(objectives[i]->index));
+    }
+    std::printf("],\n");
+
+    std::printf("    \"trackers\": [");
+    const auto& tracked = session.GetTrackers();
+    for (std::size_t i = 0; i < tracked.size(); i++) {
+        const auto& completed = tracked[i]->completed;
+        std::printf("%s{ \"region\": \"0x%X\", \"completed\": [%u, %u, %u, %u, %u, %u, %u] }", i ? ", " : "", tracked[i]->region->formID, completed[0], completed[1], completed[2], completed[3], completed[4], completed[5], completed[6]);
+    }
+    std::printf("]\n  }\n}\n");
+
+    if (!complete) {
+        std::fprintf(stderr, "replay: '%s' ends mid-record, replayed the first '%zu' records\n", trace.string().c_str(), records.size());
+    }
+
+    return 0;
+}
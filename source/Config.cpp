@@ -0,0 +1,412 @@
+#include "Config.h"
+#include "Json.h"
+
+namespace
+{
+    const std::filesystem::path Directory{ "Data/SKSE/Plugins/Bounty Quests Redone - NG" };
+    const std::filesystem::path CachePath{ Directory / "Catalogue.bin" };
+
+    template <class T, class F>
+    auto ReadEntries(const std::filesystem::path& a_path, std::string_view a_root, F a_field) -> std::vector<T>
+    {
+        std::ifstream stream(a_path);
+        return Json::ReadEntries<T>(stream, a_root, std::move(a_field));
+    }
+
+    auto CountQuests(const Config::Quests& a_quests) -> std::size_t
+    {
+        std::size_t count = 0;
+        for (const auto& [file, quests] : a_quests) {
+            count += quests.size();
+        }
+        return count;
+    }
+
+    struct QuestHash
+    {
+        std::size_t operator()(const Config::Quest& a_quest) const
+        {
+            std::size_t seed = 0;
+            const auto combine = [&seed](std::size_t a_value) { seed ^= a_value + 0x9E3779B97F4A7C15ULL + (seed << 6) + (seed >> 2); };
+
+            const std::hash<std::string> string;
+            combine(string(a_quest.name));
+            combine(string(a_quest.difficulty));
+            combine(string(a_quest.type));
+            for (const auto& form : { a_quest.location, a_quest.region, a_quest.quest }) {
+                combine(form.formID);
+                combine(string(form.modName));
+            }
+            return seed;
+        }
+    };
+
+    void RunParallel(std::vector<std::function<void()>>& a_jobs)
+    {
+        const auto count = std::min<std::size_t>(a_jobs.size(), std::max(1U, std::thread::hardware_concurrency()));
+
+        std::atomic<std::size_t> next{ 0 };
+        std::vector<std::jthread> workers;
+        workers.reserve(count);
+
+        for (std::size_t i = 0; i < count; i++) {
+            workers.emplace_back([&a_jobs, &next]() {
+                for (auto job = next++; job < a_jobs.size(); job = next++) {
+                    a_jobs[job]();
+                }
+            });
+        }
+    }
+}
+
+auto Config::GetQuests() const -> const Quests&
+{
+    return quests;
+}
+
+auto Config::GetRewards() const -> const std::vector<Reward>&
+{
+    return rewards;
+}
+
+auto Config::GetTexts() const -> const std::vector<Text>&
+{
+    return texts;
+}
+
+auto Config::GetTrackers() const -> const std::vector<Tracker>&
+{
+    return trackers;
+}
+
+void Config::Load()
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::filesystem::path> files;
+
+    for (auto const& entry : std::filesystem::directory_iterator{ Directory / "Quests" }) {
+        if (entry.path().extension() == ".json") {
+            files.push_back(std::filesystem::absolute(entry.path()));
+        }
+    }
+
+    sources.clear();
+    for (const auto& file : files) {
+        sources.push_back(GetSource(file));
+    }
+    sources.push_back(GetSource(Directory / "Rewards.json"));
+    sources.push_back(GetSource(Directory / "Trackers.json"));
+    sources.push_back(GetSource(Directory / "Texts.json"));
+
+    if (ReadCache(sources)) {
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        INFO("Config::Load :: Loaded '{}' quests, '{}' rewards, '{}' trackers and '{}' texts from cache in '{}' ms.", CountQuests(quests), rewards.size(), trackers.size(), texts.size(), elapsed.count());
+        return;
+    }
+
+    std::vector<std::optional<std::vector<Quest>>> questFiles(files.size());
+    std::vector<std::function<void()>> jobs;
+
+    for (std::size_t i = 0; i < files.size(); i++) {
+        jobs.emplace_back([&questFiles, &files, i]() { questFiles[i] = ReadQuests(files[i]); });
+    }
+
+    jobs.emplace_back([this]() { rewards = ReadRewards(Directory / "Rewards.json"); });
+    jobs.emplace_back([this]() { trackers = ReadTrackers(Directory / "Trackers.json"); });
+    jobs.emplace_back([this]() { texts = ReadTexts(Directory / "Texts.json"); });
+
+    RunParallel(jobs);
+
+    quests.clear();
+    std::size_t failed = 0;
+    for (std::size_t i = 0; i < files.size(); i++) {
+        if (!questFiles[i]) {
+            failed++;
+        } else if (!questFiles[i]->empty()) {
+            quests.insert_or_assign(files[i].generic_string(), std::move(*questFiles[i]));
+        }
+    }
+
+    // A file that failed to parse must not be cached as empty; the next load parses it again.
+    if (failed) {
+        WARN("Config::Load :: '{}' quest files failed to parse, not writing the catalogue cache.", failed);
+    } else {
+        WriteCache(sources);
+    }
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    INFO("Config::Load :: Parsed '{}' quests from '{}' files, '{}' rewards, '{}' trackers and '{}' texts in '{}' ms.", CountQuests(quests), files.size(), rewards.size(), trackers.size(), texts.size(), elapsed.count());
+}
+
+auto Config::Reload() -> Changes
+{
+    const auto start = std::chrono::steady_clock::now();
+    const auto directory = std::filesystem::absolute(Directory / "Quests");
+
+    Changes changes{};
+    std::unordered_set<std::string> present;
+    std::unordered_map<std::string, std::size_t> known;
+
+    for (std::size_t i = 0; i < sources.size(); i++) {
+        known.try_emplace(sources[i].path, i);
+    }
+
+    for (auto const& entry : std::filesystem::directory_iterator{ directory }) {
+        if (entry.path().extension() != ".json") {
+            continue;
+        }
+
+        const auto path = std::filesystem::absolute(entry.path());
+        const auto key = path.generic_string();
+        present.insert(key);
+
+        const auto it = known.find(key);
+
+        if (it != known.end()) {
+            const auto& stored = sources[it->second];
+
+            // Size and timestamp first so untouched files are never opened.
+            std::error_code error;
+            const auto size = std::filesystem::file_size(path, error);
+            const auto time = std::filesystem::last_write_time(path, error).time_since_epoch().count();
+
+            if (size == stored.size && time == stored.time) {
+                continue;
+            }
+        }
+
+        auto source = GetSource(path);
+
+        if (it != known.end() && source.hash == sources[it->second].hash) {
+            sources[it->second] = std::move(source);
+            continue;
+        }
+
+        // A file saved mid-edit keeps its previous records and source, so it is read again on the
+        // next reload instead of taking its quests off the board.
+        auto records = ReadQuests(path);
+
+        if (!records) {
+            changes.failed++;
+            continue;
+        }
+
+        if (it != known.end()) {
+            sources[it->second] = std::move(source);
+        } else {
+            sources.push_back(std::move(source));
+        }
+
+        changes.files++;
+        DiffQuests(key, std::move(*records), changes);
+    }
+
+    for (auto it = sources.begin(); it != sources.end();) {
+        if (std::filesystem::path(it->path).parent_path() == directory && !present.contains(it->path)) {
+            changes.files++;
+            DiffQuests(it->path, {}, changes);
+            it = sources.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    if (changes.failed) {
+        WARN("Config::Reload :: '{}' quest files failed to parse and were left as they were, not writing the catalogue cache.", changes.failed);
+    } else if (changes.files) {
+        WriteCache(sources);
+    }
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    INFO("Config::Reload :: '{}' changed files, '{}' added and '{}' removed quests in '{}' ms.", changes.files, changes.added.size(), changes.removed.size(), elapsed.count());
+
+    return changes;
+}
+
+void Config::DiffQuests(const std::string& a_file, std::vector<Quest> a_quests, Changes& a_changes)
+{
+    std::vector<Quest> previous;
+
+    if (const auto it = quests.find(a_file); it != quests.end()) {
+        previous = std::move(it->second);
+        quests.erase(it);
+    }
+
+    // Unchanged records pair up through the hash index, so the diff is linear in the size of the file.
+    std::unordered_multimap<Quest, std::size_t, QuestHash> index;
+    index.reserve(previous.size());
+    for (std::size_t i = 0; i < previous.size(); i++) {
+        index.emplace(previous[i], i);
+    }
+
+    std::vector<bool> kept(previous.size(), false);
+
+    for (const auto& quest : a_quests) {
+        const auto [first, last] = index.equal_range(quest);
+        const auto match = std::find_if(first, last, [&kept](const auto& a_entry) { return !kept[a_entry.second]; });
+
+        if (match != last) {
+            kept[match->second] = true;
+        } else {
+            a_changes.added.push_back(quest);
+        }
+    }
+
+    for (std::size_t i = 0; i < previous.size(); i++) {
+        if (!kept[i]) {
+            a_changes.removed.push_back(std::move(previous[i]));
+        }
+    }
+
+    if (!a_quests.empty()) {
+        quests.insert_or_assign(a_file, std::move(a_quests));
+    }
+}
+
+bool Config::ReadCache(const std::vector<Source>& a_sources)
+{
+    std::ifstream stream(CachePath, std::ios::binary);
+    if (!stream) {
+        return false;
+    }
+
+    const std::vector<char> buffer{ std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>() };
+    Binary::Reader reader(std::as_bytes(std::span(buffer)));
+
+    if (!Cache::Decode(reader, a_sources, quests, rewards, trackers, texts)) {
+        INFO("Config::ReadCache :: Catalogue cache is missing or out of date.");
+        return false;
+    }
+
+    return true;
+}
+
+void Config::WriteCache(const std::vector<Source>& a_sources) const
+{
+    Binary::Writer writer;
+    Cache::Encode(writer, a_sources, quests, rewards, trackers, texts);
+
+    auto temporary = CachePath;
+    temporary += ".tmp";
+
+    {
+        std::ofstream stream(temporary, std::ios::binary | std::ios::trunc);
+        const auto& data = writer.GetData();
+        stream.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        if (!stream) {
+            WARN("Config::WriteCache :: Failed to write catalogue cache: '{}'", temporary.string());
+            return;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporary, CachePath, error);
+    if (error) {
+        WARN("Config::WriteCache :: Failed to replace catalogue cache: '{}'", error.message());
+    }
+}
+
+auto Config::GetSource(const std::filesystem::path& a_path) -> Source
+{
+    Source source{ std::filesystem::absolute(a_path).generic_string(), 0, 0, 0 };
+
+    std::error_code error;
+    source.size = std::filesystem::file_size(a_path, error);
+    source.time = std::filesystem::last_write_time(a_path, error).time_since_epoch().count();
+
+    std::ifstream stream(a_path, std::ios::binary);
+    const std::vector<char> buffer{ std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>() };
+    source.hash = Binary::Hash(std::as_bytes(std::span(buffer)));
+
+    return source;
+}
+
+auto Config::ReadQuests(const std::filesystem::path& a_path) -> std::optional<std::vector<Quest>>
+{
+    std::vector<Quest> result;
+
+    try {
+        result = ReadEntries<Quest>(a_path, "Quests", Entries::ReadQuest);
+
+        std::erase_if(result, [&a_path](const Quest& a_quest) {
+            if (!Entries::IsValid(a_quest)) {
+                WARN("Config::ReadQuests :: Skipping incomplete quest: '{}' in file: '{}'", a_quest.name, a_path.string());
+                return true;
+            }
+            return false;
+        });
+
+        const auto file = std::filesystem::absolute(a_path).generic_string();
+        for (auto& quest : result) {
+            quest.file = file;
+        }
+    } catch (const std::exception& e) {
+        ERROR("Config::ReadQuests :: Failed to parse file: '{}'. Error: '{}'", a_path.string(), e.what());
+        return std::nullopt;
+    }
+
+    return result;
+}
+
+auto Config::ReadRewards(const std::filesystem::path& a_path) -> std::vector<Reward>
+{
+    std::vector<Reward> result;
+
+    try {
+        result = ReadEntries<Reward>(a_path, "Rewards", Entries::ReadReward);
+
+        std::erase_if(result, [&a_path](const Reward& a_reward) {
+            if (!Entries::IsValid(a_reward)) {
+                WARN("Config::ReadRewards :: Skipping incomplete reward: '0x{:x}' in file: '{}'", a_reward.form.formID, a_path.string());
+                return true;
+            }
+            return false;
+        });
+    } catch (const std::exception& e) {
+        ERROR("Config::ReadRewards :: Failed to parse file: '{}'. Error: '{}'", a_path.string(), e.what());
+        result.clear();
+    }
+
+    return result;
+}
+
+auto Config::ReadTexts(const std::filesystem::path& a_path) -> std::vector<Text>
+{
+    std::vector<Text> result;
+
+    try {
+        const auto entries = ReadEntries<std::vector<Text>>(a_path, "Texts", Entries::ReadTexts);
+
+        for (const auto& entry : entries) {
+            result.insert(result.end(), entry.begin(), entry.end());
+        }
+    } catch (const std::exception& e) {
+        ERROR("Config::ReadTexts :: Failed to parse file: '{}'. Error: '{}'", a_path.string(), e.what());
+        result.clear();
+    }
+
+    return result;
+}
+
+auto Config::ReadTrackers(const std::filesystem::path& a_path) -> std::vector<Tracker>
+{
+    std::vector<Tracker> result;
+
+    try {
+        result = ReadEntries<Tracker>(a_path, "Trackers", Entries::ReadTracker);
+
+        std::erase_if(result, [&a_path](const Tracker& a_tracker) {
+            if (!Entries::IsValid(a_tracker)) {
+                WARN("Config::ReadTrackers :: Skipping incomplete tracker: '0x{:x}' in file: '{}'", a_tracker.global.formID, a_path.string());
+                return true;
+            }
+            return false;
+        });
+    } catch (const std::exception& e) {
+        ERROR("Config::ReadTrackers :: Failed to parse file: '{}'. Error: '{}'", a_path.string(), e.what());
+        result.clear();
+    }
+
+    return result;
+}
@@ -1,7 +1,38 @@
 #include "Events.h"
+#include "Recorder.h"
 #include "Util.h"
 #include "System.h"
 #include "Serialization.h"
+#include "Scheduler.h"
+#include "Stats.h"
+#include "Trace.h"
+
+namespace
+{
+    auto GetMenu(const RE::BSFixedString& a_name) -> Recorder::Menu
+    {
+        using Menu = Recorder::Menu;
+
+        constexpr std::array<std::pair<std::string_view, Menu>, 8> menus{ {
+            { RE::GiftMenu::MENU_NAME, Menu::GiftMenu },
+            { RE::DialogueMenu::MENU_NAME, Menu::DialogueMenu },
+            { RE::BarterMenu::MENU_NAME, Menu::BarterMenu },
+            { RE::ContainerMenu::MENU_NAME, Menu::ContainerMenu },
+            { RE::InventoryMenu::MENU_NAME, Menu::InventoryMenu },
+            { RE::JournalMenu::MENU_NAME, Menu::JournalMenu },
+            { RE::LoadingMenu::MENU_NAME, Menu::LoadingMenu },
+            { RE::MapMenu::MENU_NAME, Menu::MapMenu }
+        } };
+
+        for (const auto& [name, menu] : menus) {
+            if (a_name == name) {
+                return menu;
+            }
+        }
+
+        return Menu::Other;
+    }
+}
 
 Events* Events::GetSingleton()
 {
@@ -15,6 +46,7 @@ void Events::Register()
     if (const auto events = RE::ScriptEventSourceHolder::GetSingleton()) {
         events->GetEventSource<RE::TESActorLocationChangeEvent>()->AddEventSink(GetSingleton());
         events->GetEventSource<RE::TESContainerChangedEvent>()->AddEventSink(GetSingleton());
+        events->GetEventSource<RE::TESDeathEvent>()->AddEventSink(GetSingleton());
 
         auto UI = RE::UI::GetSingleton();
         if (UI) {
@@ -24,22 +56,31 @@ void Events::Register()
         INFO("Events::Register :: Registered for MenuOpenCloseEvent");
         INFO("Events::Register :: Registered for TESActorLocationChangeEvent");
         INFO("Events::Register :: Registered for TESContainerChangedEvent");
+        INFO("Events::Register :: Registered for TESDeathEvent");
     }
 }
 
 EventResult Events::ProcessEvent(const RE::MenuOpenCloseEvent* a_event, RE::BSTEventSource<RE::MenuOpenCloseEvent>*)
 {
+    Stats::Scope scope(Stats::Metric::MenuOpenCloseEvent);
+    PROFILE_ZONE("Events::MenuOpenCloseEvent");
+
     if (!a_event) {
         return EventResult::kContinue;
     }
 
+    if (const auto recorder = Recorder::GetSingleton(); recorder->IsEnabled()) {
+        recorder->Record(Recorder::Event::MenuOpenClose, { static_cast<std::uint64_t>(GetMenu(a_event->menuName)), a_event->opening });
+    }
+
     if (a_event->menuName == RE::GiftMenu::MENU_NAME && !a_event->opening) {
-        std::jthread thread(&System::StartQuests);
-        thread.detach();
+        Scheduler::GetSingleton()->Enqueue("StartQuests", []() { System::StartQuests(); });
     }
 
     if (a_event->menuName == RE::DialogueMenu::MENU_NAME && a_event->opening) {
-        System::GetSingleton()->UpdateGlobals();
+        if (const auto player = RE::PlayerCharacter::GetSingleton(); player) {
+            System::GetSingleton()->UpdateGlobals(player->GetCurrentLocation());
+        }
     }
 
     return EventResult::kContinue;
@@ -47,6 +88,9 @@ EventResult Events::ProcessEvent(const RE::MenuOpenCloseEvent* a_event, RE::BSTE
 
 EventResult Events::ProcessEvent(const RE::TESActorLocationChangeEvent* a_event, RE::BSTEventSource<RE::TESActorLocationChangeEvent>*)
 {
+    Stats::Scope scope(Stats::Metric::TESActorLocationChangeEvent);
+    PROFILE_ZONE("Events::TESActorLocationChangeEvent");
+
     if (!a_event) {
         return EventResult::kContinue;
     }
@@ -54,22 +98,19 @@ EventResult Events::ProcessEvent(const RE::TESActorLocationChangeEvent* a_event,
     if (auto actor = a_event->actor.get(); actor) {
         if (actor == RE::PlayerCharacter::GetSingleton()) {
             if (auto newLocation = a_event->newLoc; newLocation) {
-                INFO("Events::TESActorLocationChangeEvent :: Passing location: '{}' | '0x{:x}'", newLocation->GetName(), newLocation->GetFormID());
-                auto trackers = Serialization::GetSingleton()->GetTrackers();
-
-                for (auto& tracker : trackers) {
-                    auto currentLocation = newLocation;
-                    while (currentLocation) {
-                        if (tracker->region == currentLocation) {
-                            INFO("Events::TESActorLocationChangeEvent :: Found parent region: '{}' | '0x{:x}'", currentLocation->GetName(), currentLocation->GetFormID());
-                            const auto BQRNG_Catalogue = Util::GetSingleton()->GetQuest(Offsets::Forms::BQRNG_Catalogue, "Bounty Quests Redone - NG.esl");
-
-                            std::jthread thread(&System::UpdateLocationAlias, BQRNG_Catalogue, currentLocation);
-                            thread.detach();
-                            
-                            break;
-                        }
-                        currentLocation = currentLocation->parentLoc;
+                TRACE("Events::TESActorLocationChangeEvent :: Passing location: '{}' | '0x{:x}'", newLocation->GetName(), newLocation->GetFormID());
+                Recorder::GetSingleton()->Record(Recorder::Event::LocationChange, { newLocation->GetFormID() });
+
+                System::GetSingleton()->UpdateGlobals(newLocation);
+
+                if (const auto region = Serialization::GetSingleton()->GetTrackerRegion(newLocation); region) {
+                    TRACE("Events::TESActorLocationChangeEvent :: Found parent region: '{}' | '0x{:x}'", region->GetName(), region->GetFormID());
+                    const auto BQRNG_Catalogue = Util::GetSingleton()->GetQuest(Offsets::Forms::BQRNG_Catalogue, "Bounty Quests Redone - NG.esl");
+
+                    if (BQRNG_Catalogue) {
+                        Scheduler::GetSingleton()->Enqueue(std::format("UpdateLocationAlias:0x{:x}", BQRNG_Catalogue->GetFormID()), [BQRNG_Catalogue, region](std::stop_token a_token) {
+                            System::UpdateLocationAlias(BQRNG_Catalogue, region, a_token);
+                        });
                     }
                 }
             }
@@ -81,6 +122,9 @@ EventResult Events::ProcessEvent(const RE::TESActorLocationChangeEvent* a_event,
 
 EventResult Events::ProcessEvent(const RE::TESContainerChangedEvent* a_event, RE::BSTEventSource<RE::TESContainerChangedEvent>*)
 {
+    Stats::Scope scope(Stats::Metric::TESContainerChangedEvent);
+    PROFILE_ZONE("Events::TESContainerChangedEvent");
+
     if (!a_event) {
         return EventResult::kContinue;
     }
@@ -91,16 +135,30 @@ EventResult Events::ProcessEvent(const RE::TESContainerChangedEvent* a_event, RE
     }
 
     if (const auto baseObject = a_event->baseObj; baseObject && a_event->newContainer == player->GetFormID()) {
-        auto quests = System::GetSingleton()->GetQuests();
-        for (auto& quest : quests) {
-            if (const auto note = quest->note; note) {
-                if (note->GetFormID() == baseObject) {
-                    System::GetSingleton()->AddToQueue(std::move(quest));
-                    RE::PlayerCharacter::GetSingleton()->RemoveItem(note, 1, RE::ITEM_REMOVE_REASON::kRemove, nullptr, nullptr);
-                }
-            }
+        Recorder::GetSingleton()->Record(Recorder::Event::ContainerChanged, { baseObject, a_event->newContainer });
+
+        if (auto quest = System::GetSingleton()->GetQuestByNote(baseObject); quest) {
+            const auto note = quest->note;
+            System::GetSingleton()->AddToQueue(std::move(quest));
+            player->RemoveItem(note, 1, RE::ITEM_REMOVE_REASON::kRemove, nullptr, nullptr);
         }
     }
 
+    return EventResult::kContinue;
+}
+
+EventResult Events::ProcessEvent(const RE::TESDeathEvent* a_event, RE::BSTEventSource<RE::TESDeathEvent>*)
+{
+    Stats::Scope scope(Stats::Metric::TESDeathEvent);
+    PROFILE_ZONE("Events::TESDeathEvent");
+
+    if (!a_event || !a_event->actorDying) {
+        return EventResult::kContinue;
+    }
+
+    if (const auto actor = a_event->actorDying->As<RE::Actor>(); actor) {
+        System::GetSingleton()->InvalidateBoss(actor);
+    }
+
     return EventResult::kContinue;
 }
\ No newline at end of file
@@ -1,7 +1,11 @@
+#include "Config.h"
 #include "System.h"
 #include "Events.h"
 #include "Papyrus.h"
+#include "Recorder.h"
 #include "Serialization.h"
+#include "Settings.h"
+#include "Stats.h"
 
 void InitializeLogger()
 {
@@ -17,13 +21,30 @@ void InitializeLogger()
         std::make_shared<spdlog::sinks::msvc_sink_mt>()
     };
 
-    auto logger = std::make_shared<spdlog::logger>("global", sinks.begin(), sinks.end());
+    const auto settings = Settings::GetSingleton();
+    settings->Load();
 
-    logger->set_level(spdlog::level::info);
-    logger->flush_on(spdlog::level::info);
+    const auto& logging = settings->GetLogging();
+    std::shared_ptr<spdlog::logger> logger;
+
+    if (logging.async) {
+        spdlog::init_thread_pool(logging.queueSize, 1);
+        logger = std::make_shared<spdlog::async_logger>("global", sinks.begin(), sinks.end(), spdlog::thread_pool(), spdlog::async_overflow_policy::overrun_oldest);
+        logger->flush_on(spdlog::level::warn);
+        spdlog::flush_every(logging.flushInterval);
+    } else {
+        logger = std::make_shared<spdlog::logger>("global", sinks.begin(), sinks.end());
+        logger->flush_on(spdlog::level::info);
+    }
+
+    logger->set_level(logging.level);
 
     spdlog::set_default_logger(std::move(logger));
     spdlog::set_pattern("[%^%L%$] %v");
+
+    if (const auto& error = settings->GetError(); !error.empty()) {
+        WARN("InitializeLogger :: Failed to read settings, using defaults. Error: '{}'", error);
+    }
 }
 
 void HandleMessage(SKSE::MessagingInterface::Message* a_message)
@@ -32,9 +53,12 @@ void HandleMessage(SKSE::MessagingInterface::Message* a_message)
     case SKSE::MessagingInterface::kDataLoaded:
         {
             Events::GetSingleton()->Register();
+            Config::GetSingleton()->Load();
+
             const auto system = System::GetSingleton();
 
             system->ParseQuests();
+            system->ParseGlobals();
             system->ParseRewards();
             system->ParseTrackers();
             system->ParseTexts();
@@ -76,6 +100,14 @@ SKSEPluginLoad(const SKSE::LoadInterface* a_skse)
     const auto plugin = SKSE::PluginDeclaration::GetSingleton();
     INFO("{} v{} is loading...", plugin->GetName(), plugin->GetVersion());
 
+    const auto& diagnostics = Settings::GetSingleton()->GetDiagnostics();
+
+    Stats::GetSingleton()->SetEnabled(diagnostics.stats);
+
+    if (diagnostics.record) {
+        Recorder::GetSingleton()->SetEnabled(true);
+    }
+
     SKSE::Init(a_skse);
 
     const auto messaging_interface = SKSE::GetMessagingInterface();
@@ -1,16 +1,38 @@
 #include "Papyrus.h"
+#include "Recorder.h"
+#include "Scheduler.h"
+#include "Stats.h"
 #include "System.h"
+#include "Trace.h"
 #include "Util.h"
 
 constexpr std::string_view PapyrusClass = "BQRNG";
 
+void DumpStats(RE::StaticFunctionTag*)
+{
+    Stats::GetSingleton()->Dump();
+    Recorder::GetSingleton()->Flush();
+    PROFILE_WRITE();
+}
+
+void ReloadConfig(RE::StaticFunctionTag*)
+{
+    Scheduler::GetSingleton()->Enqueue("ReloadConfig", []() { System::GetSingleton()->ReloadQuests(); });
+}
+
 void RewardPlayer(RE::StaticFunctionTag*, RE::BGSLocation* a_region)
 {
+    Stats::Scope scope(Stats::Metric::RewardPlayer);
+    Recorder::GetSingleton()->Record(Recorder::Event::RewardPlayer, { a_region ? a_region->GetFormID() : 0 });
+
     System::GetSingleton()->RewardPlayer(a_region);
 }
 
 void ShowMenu(RE::StaticFunctionTag*, RE::BGSLocation* a_region, std::uint32_t a_type)
 {
+    Stats::Scope scope(Stats::Metric::ShowMenu);
+    Recorder::GetSingleton()->Record(Recorder::Event::ShowMenu, { a_region ? a_region->GetFormID() : 0, a_type });
+
     if (a_region) {
         const auto type = static_cast<Util::TYPE>(a_type);
         System::GetSingleton()->PopulateMenu(a_region, type);    
@@ -19,6 +41,9 @@ void ShowMenu(RE::StaticFunctionTag*, RE::BGSLocation* a_region, std::uint32_t a
 
 void StartEveryQuest(RE::StaticFunctionTag*, RE::BGSLocation* a_region, std::uint32_t a_type = 0)
 {
+    Stats::Scope scope(Stats::Metric::StartEveryQuest);
+    Recorder::GetSingleton()->Record(Recorder::Event::StartEveryQuest, { a_region ? a_region->GetFormID() : 0, a_type });
+
     if (a_region) {
         const auto type = static_cast<Util::TYPE>(a_type);
         System::GetSingleton()->StartEveryQuest(a_region, type);
@@ -27,6 +52,9 @@ void StartEveryQuest(RE::StaticFunctionTag*, RE::BGSLocation* a_region, std::uin
 
 void StartRandomQuest(RE::StaticFunctionTag*, RE::BGSLocation* a_region, std::uint32_t a_type)
 {
+    Stats::Scope scope(Stats::Metric::StartRandomQuest);
+    Recorder::GetSingleton()->Record(Recorder::Event::StartRandomQuest, { a_region ? a_region->GetFormID() : 0, a_type });
+
     if (a_region) {
         const auto type = static_cast<Util::TYPE>(a_type);
         System::GetSingleton()->StartRandomQuest(a_region, type);
@@ -35,6 +63,9 @@ void StartRandomQuest(RE::StaticFunctionTag*, RE::BGSLocation* a_region, std::ui
 
 void UpdateReward(RE::StaticFunctionTag*, RE::TESQuest* a_quest, std::uint16_t a_index)
 {
+    Stats::Scope scope(Stats::Metric::UpdateReward);
+    Recorder::GetSingleton()->Record(Recorder::Event::UpdateReward, { a_quest ? a_quest->GetFormID() : 0, a_index });
+
     if (a_quest) {
         System::GetSingleton()->UpdateReward(a_quest, a_index);
     }
@@ -42,6 +73,8 @@ void UpdateReward(RE::StaticFunctionTag*, RE::TESQuest* a_quest, std::uint16_t a
 
 bool Papyrus::RegisterFunctions(RE::BSScript::IVirtualMachine* a_vm)
 {
+    a_vm->RegisterFunction("DumpStats", PapyrusClass, DumpStats);
+    a_vm->RegisterFunction("ReloadConfig", PapyrusClass, ReloadConfig);
     a_vm->RegisterFunction("RewardPlayer", PapyrusClass, RewardPlayer);
     a_vm->RegisterFunction("ShowMenu", PapyrusClass, ShowMenu);
     a_vm->RegisterFunction("StartEveryQuest", PapyrusClass, StartEveryQuest);
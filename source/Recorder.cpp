@@ -0,0 +1,85 @@
+#include "Recorder.h"
+
+void Recorder::Flush()
+{
+    std::unique_lock lock(this->lock);
+    FlushLocked();
+}
+
+void Recorder::Record(Event a_event, std::initializer_list<std::uint64_t> a_values)
+{
+    if (!IsEnabled()) {
+        return;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+
+    std::unique_lock lock(this->lock);
+
+    Recording::Encode(writer, a_event, static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(now - last).count()), std::span(a_values.begin(), a_values.size()));
+
+    last = now;
+    records++;
+
+    if (writer.GetData().size() >= kFlushSize) {
+        FlushLocked();
+    }
+}
+
+void Recorder::SetEnabled(bool a_enabled)
+{
+    std::unique_lock lock(this->lock);
+
+    if (!a_enabled) {
+        FlushLocked();
+        enabled.store(false, std::memory_order_relaxed);
+        return;
+    }
+
+    auto directory = SKSE::log::log_directory();
+
+    if (!directory) {
+        WARN("Recorder::SetEnabled :: Log directory is unavailable, recording is disabled.");
+        return;
+    }
+
+    path = *directory / std::format("{} Events.bin", SKSE::PluginDeclaration::GetSingleton()->GetName());
+
+    std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+
+    if (!stream) {
+        WARN("Recorder::SetEnabled :: Failed to open: '{}', recording is disabled.", path.string());
+        return;
+    }
+
+    Binary::Writer header;
+    Recording::EncodeHeader(header);
+    stream.write(reinterpret_cast<const char*>(header.GetData().data()), static_cast<std::streamsize>(header.GetData().size()));
+
+    writer.Clear();
+    last = std::chrono::steady_clock::now();
+    records = 0;
+    enabled.store(true, std::memory_order_relaxed);
+
+    INFO("Recorder::SetEnabled :: Recording events to: '{}'", path.string());
+}
+
+void Recorder::FlushLocked()
+{
+    if (!IsEnabled() || writer.GetData().empty()) {
+        return;
+    }
+
+    std::ofstream stream(path, std::ios::binary | std::ios::app);
+
+    if (!stream) {
+        WARN("Recorder::Flush :: Failed to open: '{}'", path.string());
+        return;
+    }
+
+    const auto& data = writer.GetData();
+    stream.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    writer.Clear();
+
+    TRACE("Recorder::Flush :: Flushed '{}' records so far.", records);
+}
@@ -0,0 +1,108 @@
+#include "Scheduler.h"
+
+Scheduler::Scheduler() :
+    worker([this](std::stop_token a_token) { Run(a_token); })
+{}
+
+bool Scheduler::Enqueue(std::string a_key, Job a_job)
+{
+    return Enqueue(std::move(a_key), std::move(a_job), true);
+}
+
+bool Scheduler::Enqueue(std::string a_key, Callback a_callback)
+{
+    return Enqueue(std::move(a_key), [callback = std::move(a_callback)](std::stop_token) { callback(); }, false);
+}
+
+bool Scheduler::Enqueue(std::string a_key, Job a_job, bool a_cancellable)
+{
+    {
+        std::unique_lock lock(this->lock);
+
+        if (runningCancellable && runningKey == a_key && !runningSource.stop_requested()) {
+            runningSource.request_stop();
+            cancelled++;
+        }
+
+        const auto it = std::find_if(tasks.begin(), tasks.end(), [&a_key](const Task& a_task) { return a_task.key == a_key; });
+
+        if (it != tasks.end()) {
+            it->job = std::move(a_job);
+            it->cancellable = a_cancellable;
+            coalesced++;
+        } else if (tasks.size() >= kCapacity) {
+            dropped++;
+            WARN("Scheduler::Enqueue :: Queue is full, dropping job: '{}'", a_key);
+            return false;
+        } else {
+            tasks.emplace_back(std::move(a_key), std::move(a_job), a_cancellable, std::chrono::steady_clock::now());
+        }
+    }
+
+    condition.notify_one();
+    return true;
+}
+
+auto Scheduler::GetStats() const -> Stats
+{
+    std::unique_lock lock(this->lock);
+
+    const auto divisor = std::max<std::uint64_t>(completed, 1);
+
+    return {
+        tasks.size(),
+        completed,
+        coalesced,
+        cancelled,
+        dropped,
+        totalWait / divisor,
+        maxWait,
+        totalRun / divisor,
+        maxRun
+    };
+}
+
+void Scheduler::Run(std::stop_token a_token)
+{
+    while (!a_token.stop_requested()) {
+        Task task;
+        std::stop_token token;
+
+        {
+            std::unique_lock lock(this->lock);
+
+            if (!condition.wait(lock, a_token, [this]() { return !tasks.empty(); })) {
+                return;
+            }
+
+            task = std::move(tasks.front());
+            tasks.pop_front();
+
+            runningKey = task.key;
+            runningCancellable = task.cancellable;
+            runningSource = std::stop_source();
+            token = runningSource.get_token();
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        try {
+            task.job(token);
+        } catch (const std::exception& e) {
+            ERROR("Scheduler::Run :: Job: '{}' failed. Error: '{}'", task.key, e.what());
+        }
+        const auto end = std::chrono::steady_clock::now();
+
+        std::unique_lock lock(this->lock);
+
+        const auto wait = std::chrono::duration_cast<std::chrono::microseconds>(start - task.queued);
+        const auto run = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+        runningKey.clear();
+        runningCancellable = false;
+        completed++;
+        totalWait += wait;
+        totalRun += run;
+        maxWait = std::max(maxWait, wait);
+        maxRun = std::max(maxRun, run);
+    }
+}
@@ -1,188 +1,186 @@
 #include "Serialization.h"
+#include "Recorder.h"
 #include "System.h"
+#include "Trace.h"
 
 void Serialization::AddTracker(RE::TESGlobal* a_global, RE::BGSLocation* a_region)
 {
     INFO("Serialization::AddTracker :: Parsing tracker: '{}' with global variable: '0x{:x}'", a_region->GetName(), a_global->GetFormID());
 
     Tracker instance{a_global, a_region};
-    trackers.push_back(std::make_shared<Tracker>(instance));
-    INFO("Serialization::AddTracker :: Current number of trackers: '{}'", trackers.size());
+
+    std::unique_lock lock(this->lock);
+    trackers.Add(std::make_shared<Tracker>(instance));
+    INFO("Serialization::AddTracker :: Current number of trackers: '{}'", trackers.GetTrackers().size());
 }
 
 void Serialization::ClearTracker(RE::BGSLocation* a_region)
 {
-    INFO("Serialization::ClearTracker :: Searching for tracker: '{}'", a_region->GetName());
-    for (auto& tracker : trackers) {
-        INFO("Serialization::ClearTracker :: Parsing tracker: '{}'", tracker->region->GetName());
-        if (tracker->region == a_region) {
-            INFO("Serialization::ClearTracker :: Tracker found!");
-            tracker->global->value = 0U;
-            INFO("Serialization::ClearTracker :: Tried to clear global variable: '0x{:x}'. Result value: '{}'", tracker->global->GetFormID(), tracker->global->value);
-            tracker->reward.clear();
-            INFO("Serialization::ClearTracker :: Tried to clear reward counter. Result value: '{}'", tracker->reward.size());
-            break;
-        }
+    TRACE("Serialization::ClearTracker :: Searching for tracker: '{}'", a_region->GetName());
+    if (const auto tracker = GetTracker(a_region); tracker) {
+        TRACE("Serialization::ClearTracker :: Tracker found!");
+        tracker->global->value = 0U;
+        TRACE("Serialization::ClearTracker :: Tried to clear global variable: '0x{:x}'. Result value: '{}'", tracker->global->GetFormID(), tracker->global->value);
+        tracker->reward.clear();
+        TRACE("Serialization::ClearTracker :: Tried to clear reward counter. Result value: '{}'", tracker->reward.size());
     }
 }
 
-void Serialization::DeserializeObjectivesText(RE::TESQuest* a_quest, RE::BGSLocation* a_location, std::uint16_t a_index, const std::string a_text)
+void Serialization::DeserializeObjectivesText(const std::vector<Objective>& a_objectives)
 {
-    auto quests = System::GetSingleton()->GetQuests();
+    const auto system = System::GetSingleton();
 
-    for (auto& quest : quests) {
-        if (quest->quest == a_quest) {
-            if (quest->location == a_location) {
-                quest->objectiveIndex = a_index;
-            }
+    std::unordered_map<RE::TESQuest*, std::unordered_map<std::uint16_t, RE::BGSQuestObjective*>> questObjectives;
+    std::vector<const Objective*> owned;
 
-            for (auto& objective : quest->quest->objectives) {
-                if (objective->index == a_index) {
-                    objective->displayText = a_text;
-                }
-            }
+    // Resolved before taking this->lock: the System lookups take catalogueLock, which is ordered first.
+    for (const auto& objective : a_objectives) {
+        if (!system->IsOwner(objective.quest)) {
+            continue;
+        }
+
+        if (const auto quest = system->GetQuest(objective.quest, objective.location); quest) {
+            quest->objectiveIndex = objective.index;
+        }
 
-            if (!IsObjectiveSerialized(a_location)) {
-                objectives.push_back(std::make_unique<Objective>(a_quest, a_location, a_index, a_text));
+        auto [it, inserted] = questObjectives.try_emplace(objective.quest);
+        if (inserted) {
+            for (const auto& instance : objective.quest->objectives) {
+                it->second.try_emplace(instance->index, instance);
             }
         }
+
+        if (const auto instance = it->second.find(objective.index); instance != it->second.end()) {
+            instance->second->displayText = objective.text;
+        }
+
+        owned.push_back(&objective);
+    }
+
+    std::unique_lock lock(this->lock);
+
+    for (const auto objective : owned) {
+        objectives.Store(objective->quest, objective->location, objective->index, objective->text);
     }
 }
 
-auto Serialization::GetTrackers() const -> const std::vector<std::shared_ptr<Tracker>>&
+auto Serialization::GetObjective(RE::TESQuest* a_quest, std::uint16_t a_index) const -> std::shared_ptr<Objective>
 {
-    return trackers;
+    std::unique_lock lock(this->lock);
+
+    return objectives.Find(a_quest, a_index);
 }
 
-bool Serialization::IsLocationReserved(RE::BGSLocation* a_location) const
+auto Serialization::GetTracker(RE::BGSLocation* a_region) const -> std::shared_ptr<Tracker>
 {
-    return std::find_if(reservedLocations.begin(), reservedLocations.end(), [a_location](RE::BGSLocation* location) { return location == a_location; }) != reservedLocations.end();
+    std::unique_lock lock(this->lock);
+
+    return trackers.Find(a_region);
 }
 
-bool Serialization::IsObjectiveSerialized(RE::BGSLocation* a_location) const
+auto Serialization::GetTrackerRegion(RE::BGSLocation* a_location) -> RE::BGSLocation*
 {
-    return std::find_if(objectives.begin(), objectives.end(), [a_location](std::shared_ptr<Serialization::Objective> objective) { return objective->location == a_location; }) != objectives.end();
+    if (!a_location) {
+        return nullptr;
+    }
+
+    std::unique_lock lock(this->lock);
+    return trackers.FindRegion(a_location);
 }
 
-bool Serialization::IsTrackerSerialized(RE::TESGlobal* a_global) const
+auto Serialization::GetTrackers() const -> const std::vector<std::shared_ptr<Tracker>>&
 {
-    return std::find_if(trackers.begin(), trackers.end(), [a_global](std::shared_ptr<Serialization::Tracker> tracker) { return tracker->global == a_global; }) != trackers.end();
+    return trackers.GetTrackers();
 }
 
-// Credits to Papyrus Extender by powerofthree for the string helper functions.
-bool Serialization::ReadString(SKSE::SerializationInterface* a_interface, std::string& a_string) const
+bool Serialization::IsLocationReserved(RE::BGSLocation* a_location) const
 {
-    std::size_t size = 0;
-
-    if (!a_interface->ReadRecordData(size)) {
-        return false;
-    }
+    std::unique_lock lock(this->lock);
+    return reservations.Contains(a_location);
+}
 
-    a_string.reserve(size);
+bool Serialization::IsObjectiveSerialized(RE::TESQuest* a_quest, RE::BGSLocation* a_location) const
+{
+    std::unique_lock lock(this->lock);
+    return objectives.Contains(a_quest, a_location);
+}
 
-    if (!a_interface->ReadRecordData(a_string.data(), static_cast<std::uint32_t>(size))) {
-        return false;
-    }
-    return true;    
+bool Serialization::IsTrackerSerialized(RE::TESGlobal* a_global) const
+{
+    const auto& list = trackers.GetTrackers();
+    return std::find_if(list.begin(), list.end(), [a_global](std::shared_ptr<Serialization::Tracker> tracker) { return tracker->global == a_global; }) != list.end();
 }
 
 void Serialization::ReserveLocation(RE::BGSLocation* a_location, bool a_reserve)
 {
     if (a_location) {
+        std::unique_lock lock(this->lock);
+
         if (a_reserve) {
             INFO("Serialization::ReserveLocation :: Reserving Location: '{}'", a_location->GetName());
-            reservedLocations.push_back(a_location);
+            reservations.Insert(a_location);
         } else {
             INFO("Serialization::ReserveLocation :: Releasing Location: '{}'", a_location->GetName());
-            reservedLocations.erase(std::remove(reservedLocations.begin(), reservedLocations.end(), a_location), reservedLocations.end());
+            reservations.Erase(a_location);
         }
     }
 }
 
 void Serialization::SerializeObjectivesText(RE::TESQuest* a_quest, RE::BGSLocation* a_location, std::uint16_t a_index, std::string a_text)
 {
-    objectives.push_back(std::make_shared<Objective>(a_quest, a_location, a_index, a_text));
+    std::unique_lock lock(this->lock);
+    objectives.Store(a_quest, a_location, a_index, std::move(a_text));
 }
 
 void Serialization::SetTracker(RE::BGSLocation* a_region, Util::DIFFICULTY a_difficulty, std::uint32_t a_amount)
 {
-    INFO("Serialization::SetTracker :: Searching for tracker: '{}'", a_region->GetName());
-    for (auto& tracker : trackers) {
-        INFO("Serialization::SetTracker :: Parsing tracker: '{}'", tracker->region->GetName());
-        if (tracker->region == a_region) {
-            INFO("Serialization::SetTracker :: Tracker found!");
-            tracker->global->value = 1U;
-            INFO("Serialization::SetTracker :: Tried to set global variable: '0x{:x}'. Result value: '{}'", tracker->global->GetFormID(), tracker->global->value);
-            tracker->reward[a_difficulty] += a_amount;
-            INFO("Serialization::SetTracker :: Tried to set reward counter for difficulty: '{}' with an increase of: '{}'. Result value: '{}'", static_cast<std::uint32_t>(a_difficulty), a_amount, tracker->reward[a_difficulty]);
-            break;
-        }
+    TRACE("Serialization::SetTracker :: Searching for tracker: '{}'", a_region->GetName());
+    if (const auto tracker = GetTracker(a_region); tracker) {
+        TRACE("Serialization::SetTracker :: Tracker found!");
+        tracker->global->value = 1U;
+        TRACE("Serialization::SetTracker :: Tried to set global variable: '0x{:x}'. Result value: '{}'", tracker->global->GetFormID(), tracker->global->value);
+        tracker->reward[a_difficulty] += a_amount;
+        TRACE("Serialization::SetTracker :: Tried to set reward counter for difficulty: '{}' with an increase of: '{}'. Result value: '{}'", static_cast<std::uint32_t>(a_difficulty), a_amount, tracker->reward[a_difficulty]);
     }
 }
 
 bool Serialization::UpdateTracker(RE::TESGlobal* a_global, RE::BGSLocation* a_region, std::unordered_map<Util::DIFFICULTY, std::uint32_t>& a_reward)
 {
     if (a_global && a_region) {
-        for (auto& tracker : trackers) {
-            if (tracker->global == a_global && tracker->region == a_region) {
-                tracker->reward = a_reward;
-                INFO("Serialization::UpdateTracker :: Updated tracker '0x{:x}' for region '{}'", a_global->GetFormID(), a_region->GetName());
-                return true;
-            }
+        if (const auto tracker = GetTracker(a_region); tracker && tracker->global == a_global) {
+            tracker->reward = a_reward;
+            INFO("Serialization::UpdateTracker :: Updated tracker '0x{:x}' for region '{}'", a_global->GetFormID(), a_region->GetName());
+            return true;
         }
     }
     ERROR("Serialization::UpdateTracker :: Failed to find tracker '0x{:x}' for region '{}'", a_global->GetFormID(), a_region->GetName());
     return false;
 }
 
-bool Serialization::WriteString(SKSE::SerializationInterface* a_interface, const std::string& a_string) const
+bool Serialization::WriteRecord(SKSE::SerializationInterface* a_interface, std::uint32_t a_type, const Binary::Writer& a_writer)
 {
-    std::size_t size = a_string.length() + 1;
-    return a_interface->WriteRecordData(size) && a_interface->WriteRecordData(a_string.data(), static_cast<std::uint32_t>(size));
+    const auto& data = a_writer.GetData();
+    return a_interface->OpenRecord(a_type, kVersion) && a_interface->WriteRecordData(data.data(), static_cast<std::uint32_t>(data.size()));
 }
 
 bool Serialization::SaveObjectives(SKSE::SerializationInterface* a_interface)
 {
-    if (!a_interface->OpenRecord(kObjectives, kVersion)) {
-        ERROR("Serialization::SaveObjectives :: Failed to read record data.");
-        return false;
-    }
+    std::vector<Records::Objective> records;
 
-    std::unique_lock lock(GetSingleton()->lock);
+    {
+        std::unique_lock lock(GetSingleton()->lock);
 
-    auto& objectivesList = GetSingleton()->objectives;
-    const auto count = objectivesList.size();
-
-    if (!a_interface->WriteRecordData(&count, sizeof(count))) {
-        ERROR("Serialization::SaveObjectives :: Failed to write record data with the number of objectives! '{}'", count);
-        return false;
-    }
-
-    for (auto& objective : objectivesList) {
-        const auto quest = objective->quest->GetFormID();
-        const auto location = objective->location->GetFormID();
-        const auto index = objective->index;
-        const auto text = objective->text.data();
-
-        if (!a_interface->WriteRecordData(&quest, sizeof(quest))) {
-            ERROR("Serialization::SaveObjectives :: Failed to write record data with the quest formID! '0x{:x}'", quest);
-            return false;
-        }
-
-        if (!a_interface->WriteRecordData(&location, sizeof(location))) {
-            ERROR("Serialization::SaveObjectives :: Failed to write record data with the location formID! '0x{:x}'", location);
-            return false;
+        for (auto& objective : GetSingleton()->objectives.GetObjectives()) {
+            records.emplace_back(objective->quest->GetFormID(), objective->location->GetFormID(), objective->index, objective->text);
         }
+    }
 
-        if (!a_interface->WriteRecordData(&index, sizeof(index))) {
-            ERROR("Serialization::SaveObjectives :: Failed to write record data with the index! '{}'", index);
-            return false;
-        }
+    Binary::Writer writer;
+    Records::EncodeObjectives(writer, records);
 
-        if (!GetSingleton()->WriteString(a_interface, text)) {
-            ERROR("Serialization::SaveObjectives :: Failed to write record data with with the string! '{}'", text);
-            return false;
-        }
+    if (!WriteRecord(a_interface, kObjectives, writer)) {
+        ERROR("Serialization::SaveObjectives :: Failed to write record data with '{}' objectives!", records.size());
+        return false;
     }
 
     return true;
@@ -190,27 +188,22 @@ bool Serialization::SaveObjectives(SKSE::SerializationInterface* a_interface)
 
 bool Serialization::SaveLocations(SKSE::SerializationInterface* a_interface)
 {
-    if (!a_interface->OpenRecord(kReservedLocations, kVersion)) {
-        ERROR("Serialization::SaveLocations :: Failed to read record data.");
-        return false;
-    }
-
-    std::unique_lock lock(GetSingleton()->lock);
+    std::vector<RE::FormID> records;
 
-    auto& locations = GetSingleton()->reservedLocations;
-    const auto count = locations.size();
+    {
+        std::unique_lock lock(GetSingleton()->lock);
 
-    if (!a_interface->WriteRecordData(&count, sizeof(count))) {
-        ERROR("Serialization::SaveLocations :: Failed to write record data with the number of reserved locations! '{}'", count);
-        return false;
+        for (auto& location : GetSingleton()->reservations.GetLocations()) {
+            records.push_back(location->GetFormID());
+        }
     }
 
-    for (auto& location : locations) {
-        const auto formID = location->GetFormID();
-        if (!a_interface->WriteRecordData(&formID, sizeof(formID))) {
-            ERROR("Serialization::SaveLocations :: Failed to write record data with the reserved location formID! '0x{:x}'", formID);
-            return false;
-        }
+    Binary::Writer writer;
+    Records::EncodeLocations(writer, records);
+
+    if (!WriteRecord(a_interface, kReservedLocations, writer)) {
+        ERROR("Serialization::SaveLocations :: Failed to write record data with '{}' reserved locations!", records.size());
+        return false;
     }
 
     return true;
@@ -218,89 +211,71 @@ bool Serialization::SaveLocations(SKSE::SerializationInterface* a_interface)
 
 bool Serialization::SaveTrackers(SKSE::SerializationInterface* a_interface)
 {
-    if (!a_interface->OpenRecord(kTrackers, kVersion)) {
-        ERROR("Serialization::SaveTrackers :: Failed to read record data.");
-        return false;
-    }
+    std::vector<Records::Tracker> records;
 
-    std::unique_lock lock(GetSingleton()->lock);
-
-    auto& trackersList = GetSingleton()->GetTrackers();
-    const auto count = trackersList.size();
-
-    if (!a_interface->WriteRecordData(&count, sizeof(count))) {
-        ERROR("Serialization::SaveTrackers :: Failed to write record data with the number of trackers! '{}'", count);
-        return false;
-    }
+    {
+        std::unique_lock lock(GetSingleton()->lock);
 
-    for (auto& tracker : trackersList) {
-        const auto global = tracker->global->GetFormID();
-        const auto region = tracker->region->GetFormID();
-        
-        if (!a_interface->WriteRecordData(&global, sizeof(global))) {
-            ERROR("Serialization::SaveTrackers :: Failed to write record data with the global variable formID! '0x{:x}'", global);
-            return false;
+        for (auto& tracker : GetSingleton()->GetTrackers()) {
+            auto& record = records.emplace_back(tracker->global->GetFormID(), tracker->region->GetFormID());
+            for (const auto& [difficulty, quantity] : tracker->reward) {
+                record.reward.try_emplace(static_cast<std::uint32_t>(difficulty), quantity);
+            }
         }
+    }
 
-        if (!a_interface->WriteRecordData(&region, sizeof(region))) {
-            ERROR("Serialization::SaveTrackers :: Failed to write record data with the region formID! '0x{:x}'", region);
-            return false;
-        }
+    Binary::Writer writer;
+    Records::EncodeTrackers(writer, records);
 
-        auto& rewards = tracker->reward;
-        const auto amount = rewards.size();
+    if (!WriteRecord(a_interface, kTrackers, writer)) {
+        ERROR("Serialization::SaveTrackers :: Failed to write record data with '{}' trackers!", records.size());
+        return false;
+    }
 
-        if (!a_interface->WriteRecordData(&amount, sizeof(amount))) {
-            ERROR("Serialization::SaveTrackers :: Failed to write record data with the number of rewards! '{}'", amount);
-            return false;
-        }
+    return true;
+}
 
-        for (auto& reward : rewards) {
-            const auto difficulty = reward.first;
-            const auto quantity = reward.second;
+bool Serialization::SaveRandom(SKSE::SerializationInterface* a_interface)
+{
+    const auto state = System::GetSingleton()->GetRandomState();
 
-            if (!a_interface->WriteRecordData(&difficulty, sizeof(difficulty))) {
-                ERROR("Serialization::SaveTrackers :: Failed to write record data with the reward difficulty value! '{}'", static_cast<std::uint32_t>(difficulty));
-                return false;
-            }
+    Binary::Writer writer;
+    writer.Write(state.state);
+    writer.Write(state.increment);
 
-            if (!a_interface->WriteRecordData(&quantity, sizeof(quantity))) {
-                ERROR("Serialization::SaveTrackers :: Failed to write record data with the reward quantity value! '{}'", quantity);
-                return false;
-            }
-        }
+    if (!WriteRecord(a_interface, kRandom, writer)) {
+        ERROR("Serialization::SaveRandom :: Failed to write record data!");
+        return false;
     }
 
     return true;
 }
 
-bool Serialization::LoadObjectives(SKSE::SerializationInterface* a_interface)
+bool Serialization::LoadObjectives(SKSE::SerializationInterface* a_interface, std::uint32_t a_version, std::uint32_t a_length)
 {
-    std::size_t count;
-    a_interface->ReadRecordData(&count, sizeof(count));
-    INFO("Serialization::LoadObjectives :: Loading '{}' objectives.", count);
+    std::vector<Records::Objective> records;
+
+    if (!Records::ReadObjectives(a_interface, a_version, a_length, records)) {
+        ERROR("Serialization::LoadObjectives :: Failed to read record data!");
+        return false;
+    }
 
-    for (std::size_t i = 0; i < count; i++) {
-        RE::FormID oldQuest;
-        RE::FormID oldLocation;
-        std::uint16_t index;
-        std::string text;
+    INFO("Serialization::LoadObjectives :: Loading '{}' objectives.", records.size());
 
-        a_interface->ReadRecordData(&oldQuest, sizeof(oldQuest));
-        a_interface->ReadRecordData(&oldLocation, sizeof(oldLocation));
-        a_interface->ReadRecordData(&index, sizeof(index));
-        GetSingleton()->ReadString(a_interface, text);
+    std::vector<Objective> loaded;
+    loaded.reserve(records.size());
 
+    for (auto& record : records) {
         RE::FormID newQuest;
         RE::FormID newLocation;
 
-        if (!a_interface->ResolveFormID(oldQuest, newQuest)) {
-            ERROR("Serialization::LoadObjectives :: Failed to resolve the quest formID! '0x{:x}' -> '0x{:x}'", oldQuest, newQuest);
+        if (!a_interface->ResolveFormID(record.quest, newQuest)) {
+            ERROR("Serialization::LoadObjectives :: Failed to resolve the quest formID! '0x{:x}' -> '0x{:x}'", record.quest, newQuest);
             continue;
         }
 
-        if (!a_interface->ResolveFormID(oldLocation, newLocation)) {
-            ERROR("Serialization::LoadObjectives :: Failed to resolve the location formID! '0x{:x}' -> '0x{:x}'", oldLocation, newLocation);
+        if (!a_interface->ResolveFormID(record.location, newLocation)) {
+            ERROR("Serialization::LoadObjectives :: Failed to resolve the location formID! '0x{:x}' -> '0x{:x}'", record.location, newLocation);
             continue;
         }
 
@@ -308,25 +283,30 @@ bool Serialization::LoadObjectives(SKSE::SerializationInterface* a_interface)
         const auto location = RE::TESForm::LookupByID<RE::BGSLocation>(newLocation);
 
         if (quest && location) {
-            GetSingleton()->DeserializeObjectivesText(quest, location, index, text.data());
+            loaded.emplace_back(quest, location, record.index, std::move(record.text));
         } else {
             ERROR("Serialization::LoadObjectives");
             continue;
         }
     }
 
+    GetSingleton()->DeserializeObjectivesText(loaded);
+
     return true;
 }
 
-bool Serialization::LoadLocations(SKSE::SerializationInterface* a_interface)
+bool Serialization::LoadLocations(SKSE::SerializationInterface* a_interface, std::uint32_t a_version, std::uint32_t a_length)
 {
-    std::size_t count;
-    a_interface->ReadRecordData(&count, sizeof(count));
-    INFO("Serialization::LoadLocations :: Loading '{}' locations.", count);
+    std::vector<RE::FormID> records;
+
+    if (!Records::ReadLocations(a_interface, a_version, a_length, records)) {
+        ERROR("Serialization::LoadLocations :: Failed to read record data!");
+        return false;
+    }
 
-    for (std::size_t i = 0; i < count; i++) {
-        RE::FormID oldLocation;
-        a_interface->ReadRecordData(&oldLocation, sizeof(oldLocation));
+    INFO("Serialization::LoadLocations :: Loading '{}' locations.", records.size());
+
+    for (const auto oldLocation : records) {
         RE::FormID newLocation;
 
         if (!a_interface->ResolveFormID(oldLocation, newLocation)) {
@@ -347,50 +327,41 @@ bool Serialization::LoadLocations(SKSE::SerializationInterface* a_interface)
     return true;
 }
 
-bool Serialization::LoadTrackers(SKSE::SerializationInterface* a_interface)
+bool Serialization::LoadTrackers(SKSE::SerializationInterface* a_interface, std::uint32_t a_version, std::uint32_t a_length)
 {
-    std::size_t count;
-    a_interface->ReadRecordData(&count, sizeof(count));
-    INFO("Serialization::LoadTrackers :: Loading '{}' trackers.", count);
-
-    for (std::size_t i = 0; i < count; i++) {
-        RE::FormID oldGlobal;
-        RE::FormID oldRegion;
-        std::size_t amount;
-        std::unordered_map<Util::DIFFICULTY, std::uint32_t> temporary;
-
-        a_interface->ReadRecordData(&oldGlobal, sizeof(oldGlobal));
-        a_interface->ReadRecordData(&oldRegion, sizeof(oldRegion));
-        a_interface->ReadRecordData(&amount, sizeof(amount));
-
-        for (std::size_t j = 0; j < amount; j++) {
-            Util::DIFFICULTY difficulty;
-            std::uint32_t quantity;
+    std::vector<Records::Tracker> records;
 
-            a_interface->ReadRecordData(&difficulty, sizeof(difficulty));
-            a_interface->ReadRecordData(&quantity, sizeof(quantity));
+    if (!Records::ReadTrackers(a_interface, a_version, a_length, records)) {
+        ERROR("Serialization::LoadTrackers :: Failed to read record data!");
+        return false;
+    }
 
-            temporary.try_emplace(difficulty, quantity);
-        }
+    INFO("Serialization::LoadTrackers :: Loading '{}' trackers.", records.size());
 
+    for (auto& record : records) {
         RE::FormID newGlobal;
         RE::FormID newRegion;
 
-        if (!a_interface->ResolveFormID(oldGlobal, newGlobal)) {
-            ERROR("Serialization::LoadTrackers :: Failed to resolve the global variable formID! '0x{:x}' -> '0x{:x}'", oldGlobal, newGlobal);
+        if (!a_interface->ResolveFormID(record.global, newGlobal)) {
+            ERROR("Serialization::LoadTrackers :: Failed to resolve the global variable formID! '0x{:x}' -> '0x{:x}'", record.global, newGlobal);
             continue;
         }
 
-        if (!a_interface->ResolveFormID(oldRegion, newRegion)) {
-            ERROR("Serialization::LoadTrackers :: Failed to resolve the region formID! '0x{:x}' -> '0x{:x}'", oldRegion, newRegion);
+        if (!a_interface->ResolveFormID(record.region, newRegion)) {
+            ERROR("Serialization::LoadTrackers :: Failed to resolve the region formID! '0x{:x}' -> '0x{:x}'", record.region, newRegion);
             continue;
         }
 
         const auto global = RE::TESForm::LookupByID<RE::TESGlobal>(newGlobal);
         const auto region = RE::TESForm::LookupByID<RE::BGSLocation>(newRegion);
 
+        std::unordered_map<Util::DIFFICULTY, std::uint32_t> reward;
+        for (const auto& [difficulty, quantity] : record.reward) {
+            reward.try_emplace(static_cast<Util::DIFFICULTY>(difficulty), quantity);
+        }
+
         if (global && region) {
-            if (!GetSingleton()->UpdateTracker(global, region, temporary)) {
+            if (!GetSingleton()->UpdateTracker(global, region, reward)) {
                 continue;
             }
         } else {
@@ -402,21 +373,50 @@ bool Serialization::LoadTrackers(SKSE::SerializationInterface* a_interface)
     return true;
 }
 
+bool Serialization::LoadRandom(SKSE::SerializationInterface* a_interface, std::uint32_t a_length)
+{
+    std::vector<std::byte> buffer;
+
+    if (!Records::ReadBuffer(a_interface, a_length, buffer)) {
+        ERROR("Serialization::LoadRandom :: Failed to read record data!");
+        return false;
+    }
+
+    Binary::Reader reader(buffer);
+    Random::PCG32::State state{};
+
+    if (!reader.Read(state.state) || !reader.Read(state.increment)) {
+        ERROR("Serialization::LoadRandom :: Failed to decode record data!");
+        return false;
+    }
+
+    System::GetSingleton()->SetRandomState(state);
+    return true;
+}
+
 void Serialization::OnGameSaved(SKSE::SerializationInterface* a_interface)
 {
-    GetSingleton()->SaveObjectives(a_interface);
-    GetSingleton()->SaveLocations(a_interface);
-    GetSingleton()->SaveTrackers(a_interface);
+    {
+        PROFILE_ZONE("Serialization::OnGameSaved");
+        GetSingleton()->SaveObjectives(a_interface);
+        GetSingleton()->SaveLocations(a_interface);
+        GetSingleton()->SaveTrackers(a_interface);
+        GetSingleton()->SaveRandom(a_interface);
+    }
+
+    PROFILE_WRITE();
+    Recorder::GetSingleton()->Flush();
 }
 
 void Serialization::OnGameLoaded(SKSE::SerializationInterface* a_interface)
 {
+    PROFILE_ZONE("Serialization::OnGameLoaded");
     std::uint32_t type;
     std::uint32_t version;
     std::uint32_t length;
 
     while (a_interface->GetNextRecordInfo(type, version, length)) {
-        if (version != kVersion) {
+        if (version != 1 && version != kVersion) {
             ERROR("Serialization::OnGameLoaded :: Record data version mismatch! '{}' -> '{}'", version, static_cast<std::uint32_t>(kVersion));
             continue;
         }
@@ -424,15 +424,19 @@ void Serialization::OnGameLoaded(SKSE::SerializationInterface* a_interface)
         switch (type) {
         case kReservedLocations:
             INFO("Serialization::OnGameLoaded :: kReservedLocations");
-            GetSingleton()->LoadLocations(a_interface);
+            GetSingleton()->LoadLocations(a_interface, version, length);
             break;
         case kObjectives:
             INFO("Serialization::OnGameLoaded :: kObjectives");
-            GetSingleton()->LoadObjectives(a_interface);
+            GetSingleton()->LoadObjectives(a_interface, version, length);
             break;
         case kTrackers:
             INFO("Serialization::OnGameLoaded :: kTrackers");
-            GetSingleton()->LoadTrackers(a_interface);
+            GetSingleton()->LoadTrackers(a_interface, version, length);
+            break;
+        case kRandom:
+            INFO("Serialization::OnGameLoaded :: kRandom");
+            GetSingleton()->LoadRandom(a_interface, length);
             break;
         }
     }
@@ -440,12 +444,19 @@ void Serialization::OnGameLoaded(SKSE::SerializationInterface* a_interface)
 
 void Serialization::OnRevert(SKSE::SerializationInterface*)
 {
+    PROFILE_ZONE("Serialization::OnRevert");
     INFO("Serialization::OnRevert :: Reverting data.");
-    std::unique_lock lock(GetSingleton()->lock);
-    GetSingleton()->reservedLocations.clear();
-    GetSingleton()->objectives.clear();
 
-    for (auto& tracker : GetSingleton()->trackers) {
-        tracker->reward.clear();
+    {
+        std::unique_lock lock(GetSingleton()->lock);
+        GetSingleton()->reservations.Clear();
+        GetSingleton()->objectives.Clear();
+
+        for (auto& tracker : GetSingleton()->trackers.GetTrackers()) {
+            tracker->reward.clear();
+        }
     }
+
+    // Outside the lock: System::Revert takes randomLock and bossLock, which may not nest inside it.
+    System::GetSingleton()->Revert();
 }
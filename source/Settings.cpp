@@ -0,0 +1,87 @@
+#include "Settings.h"
+#include "Util.h"
+
+namespace
+{
+    const std::filesystem::path SettingsPath{ "Data/SKSE/Plugins/Bounty Quests Redone - NG/Settings.json" };
+}
+
+auto Settings::GetDiagnostics() const -> const Diagnostics&
+{
+    return diagnostics;
+}
+
+auto Settings::GetError() const -> const std::string&
+{
+    return error;
+}
+
+auto Settings::GetLogging() const -> const Logging&
+{
+    return logging;
+}
+
+auto Settings::GetSelection() const -> const Selection&
+{
+    return selection;
+}
+
+// Runs before the logger exists, so failures are kept in `error` and reported once logging is up.
+void Settings::Load()
+{
+    if (!std::filesystem::exists(SettingsPath)) {
+        return;
+    }
+
+    try {
+        std::ifstream stream(SettingsPath);
+        const auto root = jsoncons::json::parse(stream);
+
+        if (root.contains("Logging")) {
+            const auto& section = root["Logging"];
+
+            if (section.contains("Level")) {
+                const auto name = section["Level"].as<std::string>();
+                const auto level = spdlog::level::from_str(name);
+
+                if (level != spdlog::level::off || name == "off") {
+                    logging.level = level;
+                } else {
+                    error = std::format("unknown logging level: '{}'", name);
+                }
+            }
+
+            logging.async = section.get_value_or<bool>("Async", logging.async);
+            logging.queueSize = std::max<std::size_t>(section.get_value_or<std::size_t>("QueueSize", logging.queueSize), 128);
+            logging.flushInterval = std::chrono::seconds(std::max<std::int64_t>(section.get_value_or<std::int64_t>("FlushInterval", logging.flushInterval.count()), 1));
+        }
+
+        if (root.contains("Diagnostics")) {
+            const auto& section = root["Diagnostics"];
+
+            diagnostics.record = section.get_value_or<bool>("Record", diagnostics.record);
+            diagnostics.stats = section.get_value_or<bool>("Stats", diagnostics.stats);
+        }
+
+        if (root.contains("Selection")) {
+            const auto& section = root["Selection"];
+
+            selection.seed = section.get_value_or<std::uint64_t>("Seed", selection.seed);
+
+            if (section.contains("Weights")) {
+                for (const auto& member : section["Weights"].object_range()) {
+                    const auto difficulty = Util::GetDifficulty(member.key());
+
+                    if (difficulty == Util::DIFFICULTY::None) {
+                        error = std::format("unknown difficulty in selection weights: '{}'", member.key());
+                        continue;
+                    }
+
+                    selection.weights[static_cast<std::size_t>(difficulty)] = std::max(member.value().as<double>(), 0.0);
+                }
+            }
+        }
+    } catch (const std::exception& e) {
+        error = e.what();
+    }
+}
@@ -0,0 +1,160 @@
+#include "Stats.h"
+#include "Scheduler.h"
+#include "System.h"
+
+auto Stats::Dump() const -> std::optional<std::filesystem::path>
+{
+    auto path = SKSE::log::log_directory();
+
+    if (!path) {
+        WARN("Stats::Dump :: Log directory is unavailable.");
+        return std::nullopt;
+    }
+
+    *path /= std::format("{} Stats.txt", SKSE::PluginDeclaration::GetSingleton()->GetName());
+
+    std::ofstream stream(*path, std::ios::trunc);
+
+    if (!stream) {
+        WARN("Stats::Dump :: Failed to open: '{}'", path->string());
+        return std::nullopt;
+    }
+
+    const auto toMicroseconds = [](std::uint64_t a_value) { return static_cast<double>(a_value) / 1000.0; };
+
+    stream << std::format("Stats collection: {}\n\n", IsEnabled() ? "enabled" : "disabled");
+    stream << std::format("{:<30}{:>10}{:>14}{:>14}{:>14}{:>14}\n", "Metric", "Count", "Mean (us)", "P50 (us)", "P99 (us)", "Max (us)");
+
+    for (std::size_t i = 0; i < histograms.size(); i++) {
+        const auto& histogram = histograms[i];
+        const auto count = histogram.count.load(std::memory_order_relaxed);
+        const auto total = histogram.total.load(std::memory_order_relaxed);
+
+        stream << std::format("{:<30}{:>10}{:>14.1f}{:>14.1f}{:>14.1f}{:>14.1f}\n",
+            GetName(static_cast<Metric>(i)),
+            count,
+            count ? toMicroseconds(total / count) : 0.0,
+            toMicroseconds(GetPercentile(histogram, count, 0.50)),
+            toMicroseconds(GetPercentile(histogram, count, 0.99)),
+            toMicroseconds(histogram.max.load(std::memory_order_relaxed)));
+    }
+
+    const auto scheduler = Scheduler::GetSingleton()->GetStats();
+
+    stream << std::format("\nScheduler: depth '{}' completed '{}' coalesced '{}' cancelled '{}' dropped '{}'\n", scheduler.depth, scheduler.completed, scheduler.coalesced, scheduler.cancelled, scheduler.dropped);
+    stream << std::format("Scheduler wait: average '{}' us max '{}' us | run: average '{}' us max '{}' us\n", scheduler.averageWait.count(), scheduler.maxWait.count(), scheduler.averageRun.count(), scheduler.maxRun.count());
+
+    const auto [hits, misses] = System::GetSingleton()->GetBossCounters();
+    stream << std::format("Boss cache: hits '{}' misses '{}'\n", hits, misses);
+
+    const auto [notes, quests] = System::GetSingleton()->GetNoteCounts();
+    stream << std::format("Note forms: created '{}' of '{}' quests\n", notes, quests);
+
+    if (const auto pool = spdlog::thread_pool(); pool) {
+        stream << std::format("Async log: queued '{}' overrun '{}'\n", pool->queue_size(), pool->overrun_counter());
+    }
+
+    INFO("Stats::Dump :: Wrote stats to: '{}'", path->string());
+
+    return path;
+}
+
+void Stats::Record(Metric a_metric, std::chrono::nanoseconds a_duration)
+{
+    const auto index = static_cast<std::size_t>(a_metric);
+
+    if (index >= histograms.size()) {
+        return;
+    }
+
+    auto& histogram = histograms[index];
+    const auto value = static_cast<std::uint64_t>(std::max<std::int64_t>(a_duration.count(), 0));
+
+    histogram.count.fetch_add(1, std::memory_order_relaxed);
+    histogram.total.fetch_add(value, std::memory_order_relaxed);
+    histogram.buckets[GetBucket(value)].fetch_add(1, std::memory_order_relaxed);
+
+    auto max = histogram.max.load(std::memory_order_relaxed);
+    while (value > max && !histogram.max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {}
+}
+
+void Stats::SetEnabled(bool a_enabled)
+{
+    enabled.store(a_enabled, std::memory_order_relaxed);
+    INFO("Stats::SetEnabled :: Stats collection is {}.", a_enabled ? "enabled" : "disabled");
+}
+
+auto Stats::GetBucket(std::uint64_t a_value) -> std::size_t
+{
+    const auto width = static_cast<std::size_t>(std::bit_width(a_value));
+
+    if (width < 3) {
+        return static_cast<std::size_t>(a_value);
+    }
+
+    const auto fraction = static_cast<std::size_t>((a_value >> (width - 3)) & (kSubBuckets - 1));
+    return width * kSubBuckets + fraction;
+}
+
+auto Stats::GetBucketLimit(std::size_t a_bucket) -> std::uint64_t
+{
+    if (a_bucket < kSubBuckets) {
+        return a_bucket;
+    }
+
+    const auto width = a_bucket / kSubBuckets;
+    const auto fraction = a_bucket % kSubBuckets;
+
+    if (width >= 64) {
+        return std::numeric_limits<std::uint64_t>::max();
+    }
+
+    return ((kSubBuckets + fraction + 1) << (width - 3)) - 1;
+}
+
+auto Stats::GetName(Metric a_metric) -> std::string_view
+{
+    switch (a_metric) {
+    case Metric::RewardPlayer:
+        return "RewardPlayer";
+    case Metric::ShowMenu:
+        return "ShowMenu";
+    case Metric::StartEveryQuest:
+        return "StartEveryQuest";
+    case Metric::StartRandomQuest:
+        return "StartRandomQuest";
+    case Metric::UpdateReward:
+        return "UpdateReward";
+    case Metric::StartQuests:
+        return "StartQuests";
+    case Metric::MenuOpenCloseEvent:
+        return "MenuOpenCloseEvent";
+    case Metric::TESActorLocationChangeEvent:
+        return "TESActorLocationChangeEvent";
+    case Metric::TESContainerChangedEvent:
+        return "TESContainerChangedEvent";
+    case Metric::TESDeathEvent:
+        return "TESDeathEvent";
+    default:
+        return "Unknown";
+    }
+}
+
+auto Stats::GetPercentile(const Histogram& a_histogram, std::uint64_t a_count, double a_percentile) -> std::uint64_t
+{
+    if (!a_count) {
+        return 0;
+    }
+
+    const auto target = std::max<std::uint64_t>(static_cast<std::uint64_t>(std::ceil(static_cast<double>(a_count) * a_percentile)), 1);
+    std::uint64_t seen = 0;
+
+    for (std::size_t i = 0; i < a_histogram.buckets.size(); i++) {
+        seen += a_histogram.buckets[i].load(std::memory_order_relaxed);
+        if (seen >= target) {
+            return std::min(GetBucketLimit(i), a_histogram.max.load(std::memory_order_relaxed));
+        }
+    }
+
+    return a_histogram.max.load(std::memory_order_relaxed);
+}
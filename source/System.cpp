@@ -1,14 +1,30 @@
 #include "System.h"
 #include "RE/B/BGSLocAlias.h"
+#include "Config.h"
 #include "Serialization.h"
 #include "Offsets.h"
+#include "Scheduler.h"
+#include "Settings.h"
+#include "Stats.h"
+#include "Trace.h"
 
 #undef PlaySound
 
 void System::AddToQueue(std::shared_ptr<Quest> a_quest)
 {
     INFO("System::AddToQueue :: Adding quest: '{}' to the queue.", a_quest->location->GetName());
-    queue.push_back(a_quest);
+    queue.Push(std::move(a_quest));
+}
+
+void System::BuildIndex()
+{
+    // Quests are indexed as they are added; this only finishes what depends on the whole catalogue.
+    catalogue.ClearMasks();
+    currentMask.reset();
+
+    catalogue.BuildSamplers(Settings::GetSingleton()->GetSelection().weights);
+
+    INFO("System::BuildIndex :: Indexed '{}' quests across '{}' regions.", catalogue.GetQuests().size(), catalogue.GetRegionCount());
 }
 
 auto System::CreateNote(std::string a_name, std::string a_difficulty) -> RE::TESObjectBOOK*
@@ -22,20 +38,61 @@ auto System::CreateNote(std::string a_name, std::string a_difficulty) -> RE::TES
     return note;
 }
 
+void System::CompileObjective(std::string_view a_text)
+{
+    std::vector<std::string> unknown;
+    objectiveTemplate = Template::Compile(a_text, unknown);
+
+    for (const auto& placeholder : unknown) {
+        WARN("System::CompileObjective :: Unknown placeholder: '{}' in objective text, keeping it as written.", placeholder);
+    }
+
+    if (!Template::Contains(objectiveTemplate, Template::Kind::Location)) {
+        WARN("System::CompileObjective :: Objective text: '{}' has no '%l' placeholder, appending the location name.", a_text);
+        if (!objectiveTemplate.empty()) {
+            Template::Append(objectiveTemplate, Template::Kind::Literal, " ");
+        }
+        Template::Append(objectiveTemplate, Template::Kind::Location);
+    }
+
+    INFO("System::CompileObjective :: Compiled objective text into '{}' tokens.", objectiveTemplate.size());
+}
+
 void System::CompleteObjective(RE::BGSLocation* a_region, std::uint16_t a_index)
 {
-    for (auto& quest : quests) {
-        if (a_region == quest->region) {
-            for (auto& objective : quest->quest->objectives) {
-                if (objective->index == a_index) {
-                    SetObjectiveState(objective, RE::QUEST_OBJECTIVE_STATE::kCompletedDisplayed );
-                    SetObjectiveState(objective, RE::QUEST_OBJECTIVE_STATE::kDormant );
-                }
-            }        
+    std::shared_lock lock(catalogueLock);
+
+    for (const auto owner : catalogue.GetOwners(a_region)) {
+        for (auto& objective : owner->objectives) {
+            if (objective->index == a_index) {
+                SetObjectiveState(objective, RE::QUEST_OBJECTIVE_STATE::kCompletedDisplayed );
+                SetObjectiveState(objective, RE::QUEST_OBJECTIVE_STATE::kDormant );
+            }
         }
     }
 }
 
+void System::FormatObjective(std::string& a_buffer, const Quest& a_quest, std::uint16_t a_index) const
+{
+    thread_local std::vector<Template::Reward> amounts;
+    amounts.clear();
+
+    const auto difficulty = static_cast<std::size_t>(a_quest.difficulty);
+    for (const auto& reward : rewards) {
+        amounts.emplace_back(difficulty < reward.amount.size() ? reward.amount[difficulty] : 0U, reward.form ? reward.form->GetName() : "");
+    }
+
+    const Template::Arguments arguments{
+        Util::GetSingleton()->GetDifficulty(a_quest.difficulty),
+        a_index,
+        a_quest.location ? a_quest.location->GetName() : "",
+        a_quest.region ? a_quest.region->GetName() : "",
+        amounts
+    };
+
+    Template::Render(a_buffer, objectiveTemplate, arguments);
+}
+
 auto System::GetAliasReference(RE::TESQuest* a_quest, std::uint32_t a_index) -> RE::BGSBaseAlias*
 {
     if (a_quest) {
@@ -48,6 +105,12 @@ auto System::GetAliasReference(RE::TESQuest* a_quest, std::uint32_t a_index) ->
     return nullptr;
 }
 
+auto System::GetBossCounters() const -> std::pair<std::uint64_t, std::uint64_t>
+{
+    std::unique_lock lock(bossLock);
+    return { bossHits, bossMisses };
+}
+
 auto System::GetMapMarker(RE::BGSLocation* a_location) -> RE::TESObjectREFR*
 {
     const auto keyword = RE::TESForm::LookupByID<RE::BGSLocationRefType>(Offsets::Forms::MapMarker);
@@ -59,107 +122,211 @@ auto System::GetMapMarker(RE::BGSLocation* a_location) -> RE::TESObjectREFR*
     return nullptr;
 }
 
+auto System::GetNote(const std::shared_ptr<Quest>& a_quest) -> RE::TESObjectBOOK*
+{
+    std::unique_lock lock(noteLock);
+
+    if (!a_quest->note) {
+        a_quest->note = CreateNote(a_quest->name, a_quest->label);
+        notes.try_emplace(a_quest->note->GetFormID(), a_quest);
+        TRACE("System::GetNote :: Created note: '0x{:x}' for quest: '{}'", a_quest->note->GetFormID(), a_quest->name);
+    }
+
+    return a_quest->note;
+}
+
+auto System::GetQuest(RE::TESQuest* a_owner, RE::BGSLocation* a_location) const -> std::shared_ptr<Quest>
+{
+    std::shared_lock lock(catalogueLock);
+    return catalogue.GetQuest(a_owner, a_location);
+}
+
+// Note forms created so far against quests on the board; notes are only created when first offered.
+auto System::GetNoteCounts() const -> std::pair<std::size_t, std::size_t>
+{
+    std::shared_lock lock(catalogueLock);
+    std::unique_lock guard(noteLock);
+    return { notes.size(), catalogue.GetQuests().size() };
+}
+
+auto System::GetQuestByNote(RE::FormID a_note) const -> std::shared_ptr<Quest>
+{
+    std::unique_lock lock(noteLock);
+
+    const auto it = notes.find(a_note);
+    return it != notes.end() ? it->second : nullptr;
+}
+
 auto System::GetQuests() const -> const std::vector<std::shared_ptr<Quest>>&
 {
-    return quests;
+    return catalogue.GetQuests();
+}
+
+auto System::GetQuests(RE::BGSLocation* a_region) const -> const std::vector<std::shared_ptr<Quest>>&
+{
+    return catalogue.GetQuests(a_region);
+}
+
+auto System::GetQuests(RE::BGSLocation* a_region, Util::TYPE a_type) const -> const std::vector<std::shared_ptr<Quest>>&
+{
+    return catalogue.GetQuests(a_region, a_type);
+}
+
+auto System::GetRandomState() const -> Random::PCG32::State
+{
+    std::unique_lock lock(randomLock);
+    return random.GetState();
+}
+
+void System::InvalidateBoss(RE::Actor* a_actor)
+{
+    std::shared_lock guard(catalogueLock);
+    std::unique_lock lock(bossLock);
+
+    for (auto location = a_actor->GetEditorLocation1(); location; location = location->parentLoc) {
+        if (catalogue.Contains(location) && bosses.erase(location)) {
+            INFO("System::InvalidateBoss :: Invalidated boss state for: '{}' | '0x{:x}'", location->GetName(), location->GetFormID());
+        }
+    }
+}
+
+bool System::IsBossAlive(RE::BGSLocation* a_location, RE::BGSLocationRefType* a_type)
+{
+    const auto day = RE::Calendar::GetSingleton()->GetDaysPassed();
+
+    std::unique_lock lock(bossLock);
+
+    // A dead boss comes back once its cell resets, so that state expires after the respawn interval.
+    if (const auto it = bosses.find(a_location); it != bosses.end()) {
+        const auto iHoursToRespawnCell = RE::GameSettingCollection::GetSingleton()->GetSetting("iHoursToRespawnCell");
+        const auto respawn = iHoursToRespawnCell ? static_cast<float>(iHoursToRespawnCell->GetSInt()) / 24.0F : 10.0F;
+
+        if (it->second.alive || day - it->second.day < respawn) {
+            bossHits++;
+            return it->second.alive;
+        }
+    }
+
+    bossMisses++;
+
+    const auto alive = GetRefTypeAliveCount(a_location, a_type, 0, 0, 0, 1, 0) > 0;
+    bosses.insert_or_assign(a_location, Boss{ alive, day });
+    return alive;
+}
+
+bool System::IsOwner(RE::TESQuest* a_quest) const
+{
+    std::shared_lock lock(catalogueLock);
+    return catalogue.IsOwner(a_quest);
+}
+
+void System::ParseGlobals()
+{
+    PROFILE_ZONE("System::ParseGlobals");
+    const auto dataHandler = RE::TESDataHandler::GetSingleton();
+
+    const auto resolve = [dataHandler](RE::FormID a_formID) { return dataHandler->LookupForm<RE::TESGlobal>(a_formID, "Bounty Quests Redone - NG.esl"); };
+
+    globals[static_cast<std::size_t>(Util::TYPE::Bandit)] = resolve(Offsets::Forms::BQRNG_RegionHasBandit);
+    globals[static_cast<std::size_t>(Util::TYPE::Dragon)] = resolve(Offsets::Forms::BQRNG_RegionHasDragon);
+    globals[static_cast<std::size_t>(Util::TYPE::Draugr)] = resolve(Offsets::Forms::BQRNG_RegionHasDraugr);
+    globals[static_cast<std::size_t>(Util::TYPE::Dwemer)] = resolve(Offsets::Forms::BQRNG_RegionHasDwemer);
+    globals[static_cast<std::size_t>(Util::TYPE::Falmer)] = resolve(Offsets::Forms::BQRNG_RegionHasFalmer);
+    globals[static_cast<std::size_t>(Util::TYPE::Forsworn)] = resolve(Offsets::Forms::BQRNG_RegionHasForsworn);
+    globals[static_cast<std::size_t>(Util::TYPE::Giant)] = resolve(Offsets::Forms::BQRNG_RegionHasGiant);
+    globals[static_cast<std::size_t>(Util::TYPE::Mage)] = resolve(Offsets::Forms::BQRNG_RegionHasMage);
+    globals[static_cast<std::size_t>(Util::TYPE::Reaver)] = resolve(Offsets::Forms::BQRNG_RegionHasReaver);
+    globals[static_cast<std::size_t>(Util::TYPE::Riekling)] = resolve(Offsets::Forms::BQRNG_RegionHasRiekling);
+    globals[static_cast<std::size_t>(Util::TYPE::Vampire)] = resolve(Offsets::Forms::BQRNG_RegionHasVampire);
 }
 
 void System::ParseQuests()
 {
-    const std::filesystem::path source{"Data/SKSE/Plugins/Bounty Quests Redone - NG/Quests"};
+    PROFILE_ZONE("System::ParseQuests");
+    const auto start = std::chrono::steady_clock::now();
 
-    for (auto const& entry : std::filesystem::directory_iterator{source}) 
-    {
-        if (entry.path().extension() == ".json") {
-            std::ifstream path(std::filesystem::absolute(entry.path()));
-
-            jsoncons::json config = jsoncons::json::parse(path);
-            const jsoncons::json& questArray = config["Quests"];
-
-            const auto util = Util::GetSingleton();
-
-            for (const auto& quest : questArray.array_range()) {
-                auto name = quest["LocationName"].as<std::string>();
-                auto difficulty = util->GetDifficulty(quest["Difficulty"].as<std::string>());
-                auto location = util->GetLocation(quest["Location"]["FormID"].as<RE::FormID>(), quest["Location"]["ModName"].as<std::string>());
-                auto region = util->GetLocation(quest["Region"]["FormID"].as<RE::FormID>(), quest["Region"]["ModName"].as<std::string>());
-                auto owner = util->GetQuest(quest["Quest"]["FormID"].as<RE::FormID>(), quest["Quest"]["ModName"].as<std::string>());
-                auto type = util->GetType(quest["Type"].as<std::string>());
-
-                if (location && region && owner) {
-                    auto note = CreateNote(name, quest["Difficulty"].as<std::string>());
-                    quests.push_back(std::make_shared<Quest>(name, difficulty, location, region, owner, type, note));
-                    INFO("System::ParseQuests :: Successfully parsed quest: '{}' with type: '{}' and difficulty: '{}' from: '{}'", name, quest["Type"].as<std::string>(), quest["Difficulty"].as<std::string>(), quest["Quest"]["ModName"].as<std::string>());
-                } else {
-                    WARN("System::ParseQuests :: Failed to parse quest: '{}'", name);
-                }
+    std::unique_lock lock(catalogueLock);
+
+    for (const auto& [file, quests] : Config::GetSingleton()->GetQuests()) {
+        for (const auto& quest : quests) {
+            if (auto instance = ResolveQuest(quest); instance) {
+                catalogue.Add(instance);
+                INFO("System::ParseQuests :: Successfully parsed quest: '{}' with type: '{}' and difficulty: '{}' from: '{}'", quest.name, quest.type, quest.difficulty, quest.quest.modName);
+            } else {
+                WARN("System::ParseQuests :: Failed to parse quest: '{}'", quest.name);
             }
         }
     }
+
+    BuildIndex();
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    INFO("System::ParseQuests :: Resolved '{}' quests in '{}' ms, deferring '{}' note forms until first offered.", catalogue.GetQuests().size(), elapsed.count(), catalogue.GetQuests().size());
 }
 
 void System::ParseRewards()
 {
-    std::ifstream path("Data/SKSE/Plugins/Bounty Quests Redone - NG/Rewards.json");
-    jsoncons::json config = jsoncons::json::parse(path);
-    const jsoncons::json& rewardArray = config["Rewards"];
+    PROFILE_ZONE("System::ParseRewards");
+    const auto start = std::chrono::steady_clock::now();
 
-    for (const auto& reward : rewardArray.array_range()) {
-
-        auto formID = reward["FormID"].as<RE::FormID>();
-        auto modName = reward["ModName"].as<std::string>();
+    const auto dataHandler = RE::TESDataHandler::GetSingleton();
 
-        std::unordered_map<Util::DIFFICULTY, std::uint32_t> amount;
+    for (const auto& reward : Config::GetSingleton()->GetRewards()) {
+        const auto form = dataHandler->LookupForm<RE::TESBoundObject>(reward.form.formID, reward.form.modName);
 
-        amount[Util::DIFFICULTY::Novice] = reward["Quantity"]["Novice"].as<std::uint32_t>();
-        amount[Util::DIFFICULTY::Apprentice] = reward["Quantity"]["Apprentice"].as<std::uint32_t>();
-        amount[Util::DIFFICULTY::Adept] = reward["Quantity"]["Adept"].as<std::uint32_t>();
-        amount[Util::DIFFICULTY::Expert] = reward["Quantity"]["Expert"].as<std::uint32_t>();
-        amount[Util::DIFFICULTY::Master] = reward["Quantity"]["Master"].as<std::uint32_t>();
-        amount[Util::DIFFICULTY::Legendary] = reward["Quantity"]["Legendary"].as<std::uint32_t>();
+        if (!form) {
+            WARN("System::ParseRewards :: Invalid form: '0x{:x}' | '{}'", reward.form.formID, reward.form.modName);
+            continue;
+        }
 
-        Reward instance{ formID, modName, amount };
+        Reward instance{ reward.form.formID, reward.form.modName, form, {} };
+        for (const auto& [difficulty, amount] : reward.amount) {
+            if (const auto index = static_cast<std::size_t>(difficulty); index < instance.amount.size()) {
+                instance.amount[index] = amount;
+            }
+        }
         rewards.push_back(instance);
     }
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    INFO("System::ParseRewards :: Resolved '{}' rewards in '{}' ms.", rewards.size(), elapsed.count());
 }
 
 void System::ParseTexts()
 {
+    PROFILE_ZONE("System::ParseTexts");
+    const auto start = std::chrono::steady_clock::now();
     const auto util = Util::GetSingleton();
 
-    std::ifstream path("Data/SKSE/Plugins/Bounty Quests Redone - NG/Texts.json");
-    jsoncons::json config = jsoncons::json::parse(path);
-    const jsoncons::json& textArray = config["Texts"];
-
-    for (const auto& text : textArray.array_range()) {
-        util->SetText(Util::TEXT::Objective, text["Objective"].as<std::string>());
-        util->SetText(Util::TEXT::Novice, text["Novice"].as<std::string>());
-        util->SetText(Util::TEXT::Apprentice, text["Apprentice"].as<std::string>());
-        util->SetText(Util::TEXT::Adept, text["Adept"].as<std::string>());
-        util->SetText(Util::TEXT::Expert, text["Expert"].as<std::string>());
-        util->SetText(Util::TEXT::Master, text["Master"].as<std::string>());
-        util->SetText(Util::TEXT::Legendary, text["Legendary"].as<std::string>());
+    for (const auto& text : Config::GetSingleton()->GetTexts()) {
+        util->SetText(text.text, text.value);
     }
+
+    CompileObjective(util->GetText(Util::TEXT::Objective));
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    INFO("System::ParseTexts :: Resolved texts in '{}' ms.", elapsed.count());
 }
 
 void System::ParseTrackers()
 {
-    std::ifstream path("Data/SKSE/Plugins/Bounty Quests Redone - NG/Trackers.json");
-    jsoncons::json config = jsoncons::json::parse(path);
-    const jsoncons::json& trackerArray = config["Trackers"];
-
+    PROFILE_ZONE("System::ParseTrackers");
+    const auto start = std::chrono::steady_clock::now();
     const auto dataHandler = RE::TESDataHandler::GetSingleton();
 
-    for (const auto& tracker : trackerArray.array_range()) {
-        auto global = dataHandler->LookupForm<RE::TESGlobal>(tracker["GlobalVariable"]["FormID"].as<RE::FormID>(), tracker["GlobalVariable"]["ModName"].as<std::string>());
-        auto region = dataHandler->LookupForm<RE::BGSLocation>(tracker["Region"]["FormID"].as<RE::FormID>(), tracker["Region"]["ModName"].as<std::string>());
+    for (const auto& tracker : Config::GetSingleton()->GetTrackers()) {
+        auto global = dataHandler->LookupForm<RE::TESGlobal>(tracker.global.formID, tracker.global.modName);
+        auto region = dataHandler->LookupForm<RE::BGSLocation>(tracker.region.formID, tracker.region.modName);
 
         if (global && region) {
             Serialization::GetSingleton()->AddTracker(global, region);
         } else {
-            WARN("System::ParseTrackers :: Failed to parse tracker: '0x{:x}'.", tracker["GlobalVariable"]["FormID"].as<RE::FormID>());
+            WARN("System::ParseTrackers :: Failed to parse tracker: '0x{:x}'.", tracker.global.formID);
         }
     }
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    INFO("System::ParseTrackers :: Resolved trackers in '{}' ms.", elapsed.count());
 }
 
 void System::PopulateMenu(RE::BGSLocation* a_region, Util::TYPE a_type)
@@ -170,60 +337,210 @@ void System::PopulateMenu(RE::BGSLocation* a_region, Util::TYPE a_type)
     if (npc) {
         npc->ResetInventory(false);
 
-        for (auto& quest : quests) {
-            if (quest->region == a_region && quest->type == a_type) {
-                const auto keyword = RE::TESForm::LookupByID<RE::BGSLocationRefType>(Offsets::Forms::Boss);
+        std::shared_lock lock(catalogueLock);
 
-                if (GetRefTypeAliveCount(quest->location, keyword, 0, 0, 0, 1, 0) > 0 && !Serialization::GetSingleton()->IsLocationReserved(quest->location) && GetIsEditorLocation(quest->region, player)) {
-                    npc->AddObjectToContainer(quest->note, nullptr, 1, nullptr);
+        const auto keyword = RE::TESForm::LookupByID<RE::BGSLocationRefType>(Offsets::Forms::Boss);
+
+        for (auto& quest : GetQuests(a_region, a_type)) {
+            if (!Serialization::GetSingleton()->IsLocationReserved(quest->location) && GetIsEditorLocation(quest->region, player) && IsBossAlive(quest->location, keyword)) {
+                if (const auto note = GetNote(quest); note) {
+                    npc->AddObjectToContainer(note, nullptr, 1, nullptr);
                 }
             }
         }
+
         ShowGiftMenu(npc, player);
     }
 }
 
+void System::ReloadQuests()
+{
+    const auto start = std::chrono::steady_clock::now();
+    const auto changes = Config::GetSingleton()->Reload();
+
+    if (changes.added.empty() && changes.removed.empty()) {
+        INFO("System::ReloadQuests :: Quest catalogue is up to date.");
+        return;
+    }
+
+    std::unique_lock lock(catalogueLock);
+    std::unordered_set<RE::BGSLocation*> touched;
+
+    for (const auto& record : changes.removed) {
+        RemoveQuest(record, touched);
+    }
+
+    for (const auto& record : changes.added) {
+        if (auto quest = ResolveQuest(record); quest) {
+            if (const auto superseded = catalogue.Add(quest); superseded) {
+                Supersede(superseded, quest);
+            }
+            touched.insert(quest->region);
+        }
+    }
+
+    const auto& weights = Settings::GetSingleton()->GetSelection().weights;
+    for (const auto region : touched) {
+        catalogue.BuildSamplers(region, weights);
+    }
+
+    // Region masks feed the cached per-location masks, so those are recomputed lazily.
+    catalogue.ClearMasks();
+    currentMask.reset();
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    INFO("System::ReloadQuests :: Applied '{}' added and '{}' removed quests across '{}' regions in '{}' ms.", changes.added.size(), changes.removed.size(), touched.size(), elapsed.count());
+}
+
+void System::RemoveQuest(const Config::Quest& a_record, std::unordered_set<RE::BGSLocation*>& a_touched)
+{
+    const auto util = Util::GetSingleton();
+    const auto location = util->GetLocation(a_record.location.formID, a_record.location.modName);
+    const auto owner = util->GetQuest(a_record.quest.formID, a_record.quest.modName);
+    const auto region = util->GetLocation(a_record.region.formID, a_record.region.modName);
+
+    // A quest that is currently running keeps its location and note entries so UpdateReward and
+    // the container sink still resolve it; it is only withdrawn from the board.
+    const auto running = location && Serialization::GetSingleton()->IsLocationReserved(location);
+
+    const auto quest = catalogue.Remove(region, [&](const Quest& a_quest) {
+        return a_quest.location == location && a_quest.quest == owner && a_quest.name == a_record.name && a_quest.label == a_record.difficulty && a_quest.type == Util::GetType(a_record.type);
+    }, running);
+
+    if (!quest) {
+        return;
+    }
+
+    a_touched.insert(region);
+
+    if (running) {
+        INFO("System::RemoveQuest :: Quest: '{}' is running, keeping it until it is completed.", quest->name);
+        return;
+    }
+
+    if (quest->note) {
+        std::unique_lock lock(noteLock);
+        notes.erase(quest->note->GetFormID());
+    }
+
+    INFO("System::RemoveQuest :: Removed quest: '{}'", quest->name);
+}
+
+void System::ReleaseQuest(const std::shared_ptr<Quest>& a_quest)
+{
+    std::unique_lock guard(catalogueLock);
+
+    if (!catalogue.Release(a_quest)) {
+        return;
+    }
+
+    if (a_quest->note) {
+        std::unique_lock lock(noteLock);
+        notes.erase(a_quest->note->GetFormID());
+    }
+
+    INFO("System::ReleaseQuest :: Removed completed quest: '{}'", a_quest->name);
+}
+
+auto System::ResolveQuest(const Config::Quest& a_record) -> std::shared_ptr<Quest>
+{
+    const auto util = Util::GetSingleton();
+
+    auto difficulty = util->GetDifficulty(a_record.difficulty);
+    auto location = util->GetLocation(a_record.location.formID, a_record.location.modName);
+    auto region = util->GetLocation(a_record.region.formID, a_record.region.modName);
+    auto owner = util->GetQuest(a_record.quest.formID, a_record.quest.modName);
+    auto type = util->GetType(a_record.type);
+
+    if (location && region && owner) {
+        return std::make_shared<Quest>(a_record.name, difficulty, location, region, owner, type, nullptr, std::vector<RE::FormID>(), std::uint16_t(0), a_record.difficulty);
+    }
+
+    return nullptr;
+}
+
+void System::Revert()
+{
+    {
+        std::unique_lock lock(catalogueLock);
+        currentMask.reset();
+    }
+
+    SeedRandom();
+
+    std::unique_lock lock(bossLock);
+    bosses.clear();
+}
+
 void System::RewardPlayer(RE::BGSLocation* a_region)
 {
     if (a_region) {
         auto data = Serialization::GetSingleton();
-        for (auto& reward : rewards) {
-            auto form = RE::TESDataHandler::GetSingleton()->LookupForm(reward.formID, reward.modName);
+        const auto tracker = data->GetTracker(a_region);
 
-            if (form) {
-                for (auto& amount : reward.amount) {
-                    std::uint32_t times = 0U;
-                    auto trackers = data->GetTrackers();
+        if (!tracker) {
+            return;
+        }
 
-                    for (auto& tracker : trackers) {
-                        if (tracker->region == a_region) {
-                            times = tracker->reward[amount.first];
-                        }
-                    }
+        std::array<std::uint32_t, 7> times{};
+        for (const auto& [difficulty, count] : tracker->reward) {
+            if (const auto index = static_cast<std::size_t>(difficulty); index < times.size()) {
+                times[index] = count;
+            }
+        }
 
-                    if (amount.second && times > 0U) {
-                        const auto quantity = amount.second * times;
-                        const auto sAddItemtoInventory = RE::GameSettingCollection::GetSingleton()->GetSetting("sAddItemtoInventory");
+        const auto player = RE::PlayerCharacter::GetSingleton();
+        const auto sAddItemtoInventory = RE::GameSettingCollection::GetSingleton()->GetSetting("sAddItemtoInventory");
 
-                        RE::PlayerCharacter::GetSingleton()->AddObjectToContainer(form->As<RE::TESBoundObject>(), nullptr, quantity, nullptr);
+        std::string result;
+        bool rewarded = false;
 
-                        CompleteObjective(a_region, 0);
-                        
-                        if (sAddItemtoInventory) {
-                            std::string result = std::format("{} {}, {}", sAddItemtoInventory->GetString(), form->GetName(), quantity);
-                            RE::PlaySound("ITMGoldUpSD");
-                            RE::DebugNotification(result.c_str(), nullptr, true);
-                        }
-                    }
+        for (const auto& reward : rewards) {
+            const auto quantity = Store::GetRewardQuantity(reward.amount, times);
+
+            if (quantity > 0U) {
+                player->AddObjectToContainer(reward.form, nullptr, quantity, nullptr);
+                rewarded = true;
+
+                if (sAddItemtoInventory) {
+                    result += std::format("{}{} {}, {}", result.empty() ? "" : "; ", sAddItemtoInventory->GetString(), reward.form->GetName(), quantity);
                 }
-            } else {
-                WARN("System::RewardPlayer :: Invalid form: '0x{:x}' | '{}'", reward.formID, reward.modName);
             }
         }
+
+        if (rewarded) {
+            CompleteObjective(a_region, 0);
+
+            if (!result.empty()) {
+                RE::PlaySound("ITMGoldUpSD");
+                RE::DebugNotification(result.c_str(), nullptr, true);
+            }
+        }
+
         data->ClearTracker(a_region);
     }
 }
 
+void System::SeedRandom()
+{
+    const auto seed = Settings::GetSingleton()->GetSelection().seed;
+
+    std::unique_lock lock(randomLock);
+
+    if (seed) {
+        random.Seed(seed);
+    } else {
+        std::random_device device;
+        random.Seed((static_cast<std::uint64_t>(device()) << 32) | device(), (static_cast<std::uint64_t>(device()) << 32) | device());
+    }
+}
+
+void System::SetRandomState(const Random::PCG32::State& a_state)
+{
+    std::unique_lock lock(randomLock);
+    random.SetState(a_state);
+}
+
 void System::ShowGiftMenu(RE::TESObjectREFR* a_target, RE::TESObjectREFR* a_source)
 {
     const auto giftMenu = RE::UI::GetSingleton()->GetMenu<RE::GiftMenu>();
@@ -243,28 +560,44 @@ void System::StartEveryQuest(RE::BGSLocation* a_region, Util::TYPE a_type)
 {
     INFO("System::StartEveryQuest :: Starting every available quest from: '{}' with type: '{}'", a_region->GetName(), static_cast<std::uint32_t>(a_type));
 
-    for (const auto& quest : quests) {
-        if (quest->region == a_region && !Serialization::GetSingleton()->IsLocationReserved(quest->location)) {
-            if (quest->type == a_type || a_type == Util::TYPE::None) {
-                AddToQueue(quest);
-            }
+    std::shared_lock lock(catalogueLock);
+
+    const auto& candidates = a_type == Util::TYPE::None ? GetQuests(a_region) : GetQuests(a_region, a_type);
+
+    for (const auto& quest : candidates) {
+        if (!Serialization::GetSingleton()->IsLocationReserved(quest->location)) {
+            AddToQueue(quest);
         }
     }
 
-    std::jthread thread(&System::StartQuests);
-    thread.detach();
+    Scheduler::GetSingleton()->Enqueue("StartQuests", []() { StartQuests(); });
 }
 
 void System::StartQuests()
 {
+    Stats::Scope scope(Stats::Metric::StartQuests);
+
     const auto BQRNG_AliasGenerator = RE::TESDataHandler::GetSingleton()->LookupForm<RE::TESQuest>(Offsets::Forms::BQRNG_AliasGenerator, "Bounty Quests Redone - NG.esl");
 
     auto system = GetSingleton();
 
-    INFO("System::StartQuests :: Parsing '{}' quests.", system->queue.size());
+    auto batch = system->queue.Drain();
+    std::unordered_set<Quest*> started;
+
+    INFO("System::StartQuests :: Parsing '{}' quests.", batch.size());
+
+    const auto generatorAlias = static_cast<RE::BGSRefAlias*>(system->GetAliasReference(BQRNG_AliasGenerator, 1U));
+
+    for (auto& quest : batch) {
+        PROFILE_ZONE("System::StartQuests::Quest");
+        const auto start = std::chrono::steady_clock::now();
+
+        if (!started.insert(quest.get()).second || Serialization::GetSingleton()->IsLocationReserved(quest->location)) {
+            INFO("System::StartQuests :: Skipping quest: '{}' as it is already started.", quest->name);
+            continue;
+        }
 
-    for (auto& quest : system->queue) {
-        if (quest->location && quest->region && quest->quest) {
+        if (quest->location && quest->region && quest->quest && generatorAlias) {
             if (quest->quest && !quest->quest->IsRunning()) {
                 quest->quest->Start();
             }
@@ -277,12 +610,13 @@ void System::StartQuests()
                     std::size_t counter = 0;
                 
                     while (!reference && counter < 5) {
+                        PROFILE_ZONE("System::StartQuests::Attempt");
 
                         system->UpdateLocationAlias(BQRNG_AliasGenerator, quest->location);
 
-                        std::this_thread::sleep_for(std::chrono::milliseconds(250));
+                        WaitUntil([generatorAlias]() { return generatorAlias->GetActorReference() != nullptr; }, std::chrono::milliseconds(250));
 
-                        reference = static_cast<RE::BGSRefAlias*>(system->GetAliasReference(BQRNG_AliasGenerator, 1U))->GetActorReference();
+                        reference = generatorAlias->GetActorReference();
                         counter++;
                         
                     }
@@ -300,26 +634,19 @@ void System::StartQuests()
                     
                         for (const auto& objective : quest->quest->objectives) {
                             if (objective->index == referenceAlias->aliasID) {
-                                auto util = Util::GetSingleton();
-                                auto text = util->GetText(Util::TEXT::Objective);
+                                thread_local std::string buffer;
+                                system->FormatObjective(buffer, *quest, objective->index);
 
-                                auto result = text.replace(text.find("%d"), 2, util->GetDifficulty(quest->difficulty));
-
-                                if (objective->index < 10) {
-                                    result = result.replace(result.find("%i"), 2, "0" + std::to_string(objective->index));
-                                } else {
-                                    result = result.replace(result.find("%i"), 2, std::to_string(objective->index));
-                                }
-
-                                result = result.replace(result.find("%l"), 2, quest->location->GetName());
-
-                                objective->displayText = result;
+                                objective->displayText = buffer;
 
                                 Serialization::GetSingleton()->SerializeObjectivesText(quest->quest, quest->location, objective->index, objective->displayText.c_str());
                                 quest->objectiveIndex = objective->index;
                                 SetObjectiveState(objective, RE::QUEST_OBJECTIVE_STATE::kDisplayed);
                             }
                         }
+
+                        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+                        INFO("System::StartQuests :: Started quest: '{}' in '{}' ms after '{}' attempts.", quest->name, elapsed.count(), counter);
                         break;
                     }
                     break;
@@ -328,7 +655,6 @@ void System::StartQuests()
         } else {
             WARN("System::StartQuests :: Quest: '{}' couldn't be started due to missing or invalid data.", quest->name);
         }
-        system->queue.clear();
     }
 }
 
@@ -336,83 +662,128 @@ void System::StartRandomQuest(RE::BGSLocation* a_region, Util::TYPE a_type)
 {
     INFO("System::StartRandomQuest :: Starting random quest from: '{}' with type: '{}'", a_region->GetName(), static_cast<std::uint32_t>(a_type));
 
-    std::vector<std::shared_ptr<Quest>> temporary;
+    std::shared_lock guard(catalogueLock);
+
+    const auto& candidates = a_type == Util::TYPE::None ? GetQuests(a_region) : GetQuests(a_region, a_type);
+    const auto sampler = catalogue.GetSampler(a_region, a_type);
+
+    if (candidates.empty() || !sampler) {
+        WARN("System::StartRandomQuest :: No quests available in: '{}' with type: '{}'", a_region->GetName(), static_cast<std::uint32_t>(a_type));
+        return;
+    }
+
+    if (!sampler->IsEmpty() && sampler->GetSize() != candidates.size()) {
+        ERROR("System::StartRandomQuest :: Alias table for: '{}' with type: '{}' covers '{}' quests but the region has '{}', skipping.", a_region->GetName(), static_cast<std::uint32_t>(a_type), sampler->GetSize(), candidates.size());
+        return;
+    }
+
+    // Only the draws happen under randomLock; reservations are checked after it is released, since
+    // IsLocationReserved takes Serialization's lock. The fallback pass gets its own generator seeded
+    // from the shared one, so selections still follow from the saved state.
+    std::array<std::size_t, 16> draws{};
+    std::size_t drawn = 0;
+    Random::PCG32 fallback;
+
+    {
+        std::unique_lock lock(randomLock);
 
-    for (const auto& quest : quests) {
-        if (quest->region == a_region && !Serialization::GetSingleton()->IsLocationReserved(quest->location)) {
-            if (quest->type == a_type || a_type == Util::TYPE::None) {
-                temporary.push_back(quest);
+        if (!sampler->IsEmpty()) {
+            for (auto& draw : draws) {
+                draw = sampler->Sample(random);
             }
+            drawn = draws.size();
         }
+
+        const auto seed = (static_cast<std::uint64_t>(random.Next()) << 32) | random.Next();
+        fallback.Seed(seed);
     }
 
-    const auto random = std::rand() % temporary.size();
+    const auto serialization = Serialization::GetSingleton();
+    std::shared_ptr<Quest> selected;
+
+    // Reserved quests are rejected and redrawn, which keeps the table valid without a rebuild.
+    // If most of the region is taken, fall back to a weighted reservoir pass over the rest.
+    for (std::size_t attempt = 0; attempt < drawn && !selected; attempt++) {
+        const auto& quest = candidates[draws[attempt]];
+        if (!serialization->IsLocationReserved(quest->location)) {
+            selected = quest;
+        }
+    }
 
-    AddToQueue(temporary[random]);
+    if (!selected) {
+        const auto& weights = Settings::GetSingleton()->GetSelection().weights;
+        double total = 0.0;
 
-    std::jthread thread(&System::StartQuests);
-    thread.detach();
+        for (const auto& quest : candidates) {
+            // The table is empty when every weight is zero; those difficulties stay disabled here too.
+            const auto weight = weights[static_cast<std::size_t>(quest->difficulty)];
+            if (weight <= 0.0 || serialization->IsLocationReserved(quest->location)) {
+                continue;
+            }
+
+            total += weight;
+            if (fallback.NextDouble() * total < weight) {
+                selected = quest;
+            }
+        }
+    }
+
+    if (!selected) {
+        WARN("System::StartRandomQuest :: Every quest in: '{}' with type: '{}' is already reserved or has a selection weight of zero.", a_region->GetName(), static_cast<std::uint32_t>(a_type));
+        return;
+    }
+
+    AddToQueue(std::move(selected));
+
+    Scheduler::GetSingleton()->Enqueue("StartQuests", []() { StartQuests(); });
 }
 
-void System::UpdateGlobals()
+void System::Supersede(const std::shared_ptr<Quest>& a_previous, const std::shared_ptr<Quest>& a_quest)
 {
-    const auto player = RE::PlayerCharacter::GetSingleton();
-    const auto dataHandler = RE::TESDataHandler::GetSingleton();
+    // The running instance now resolves to the new record, so it must finish under the same objective and note.
+    a_quest->objectiveIndex = a_previous->objectiveIndex;
 
-    auto hasBandit = dataHandler->LookupForm<RE::TESGlobal>(Offsets::Forms::BQRNG_RegionHasBandit, "Bounty Quests Redone - NG.esl");
-    auto hasDragon = dataHandler->LookupForm<RE::TESGlobal>(Offsets::Forms::BQRNG_RegionHasDragon, "Bounty Quests Redone - NG.esl");
-    auto hasDraugr = dataHandler->LookupForm<RE::TESGlobal>(Offsets::Forms::BQRNG_RegionHasDraugr, "Bounty Quests Redone - NG.esl");
-    auto hasDwemer = dataHandler->LookupForm<RE::TESGlobal>(Offsets::Forms::BQRNG_RegionHasDwemer, "Bounty Quests Redone - NG.esl");
-    auto hasFalmer = dataHandler->LookupForm<RE::TESGlobal>(Offsets::Forms::BQRNG_RegionHasFalmer, "Bounty Quests Redone - NG.esl");
-    auto hasForsworn = dataHandler->LookupForm<RE::TESGlobal>(Offsets::Forms::BQRNG_RegionHasForsworn, "Bounty Quests Redone - NG.esl");
-    auto hasGiant = dataHandler->LookupForm<RE::TESGlobal>(Offsets::Forms::BQRNG_RegionHasGiant, "Bounty Quests Redone - NG.esl");
-    auto hasMage = dataHandler->LookupForm<RE::TESGlobal>(Offsets::Forms::BQRNG_RegionHasMage, "Bounty Quests Redone - NG.esl");
-    auto hasReaver = dataHandler->LookupForm<RE::TESGlobal>(Offsets::Forms::BQRNG_RegionHasReaver, "Bounty Quests Redone - NG.esl");
-    auto hasRiekling = dataHandler->LookupForm<RE::TESGlobal>(Offsets::Forms::BQRNG_RegionHasRiekling, "Bounty Quests Redone - NG.esl");
-    auto hasVampire = dataHandler->LookupForm<RE::TESGlobal>(Offsets::Forms::BQRNG_RegionHasVampire, "Bounty Quests Redone - NG.esl");
-
-    hasBandit->value = 0U;
-    hasDragon->value = 0U;
-    hasDraugr->value = 0U;
-    hasDwemer->value = 0U;
-    hasFalmer->value = 0U;
-    hasForsworn->value = 0U;
-    hasGiant->value = 0U;
-    hasMage->value = 0U;
-    hasReaver->value = 0U;
-    hasRiekling->value = 0U;
-    hasVampire->value = 0U;
-    
-    for (const auto& quest : quests) {
-        if (GetIsEditorLocation(quest->region, player)) {
-            if (quest->type == Util::TYPE::Bandit) {
-                hasBandit->value = 1U;
-            } else if (quest->type == Util::TYPE::Dragon) {
-                hasDragon->value = 1U;
-            } else if (quest->type == Util::TYPE::Draugr) {
-                hasDraugr->value = 1U;
-            } else if (quest->type == Util::TYPE::Dwemer) {
-                hasDwemer->value = 1U;
-            } else if (quest->type == Util::TYPE::Falmer) {
-                hasFalmer->value = 1U;
-            } else if (quest->type == Util::TYPE::Forsworn) {
-                hasForsworn->value = 1U;
-            } else if (quest->type == Util::TYPE::Giant) {
-                hasGiant->value = 1U;
-            } else if (quest->type == Util::TYPE::Mage) {
-                hasMage->value = 1U;
-            } else if (quest->type == Util::TYPE::Reaver) {
-                hasReaver->value = 1U;
-            } else if (quest->type == Util::TYPE::Riekling) {
-                hasRiekling->value = 1U;
-            } else if (quest->type == Util::TYPE::Vampire) {
-                hasVampire->value = 1U;
-            }
+    if (a_previous->note) {
+        std::unique_lock lock(noteLock);
+        a_quest->note = a_previous->note;
+        notes.insert_or_assign(a_quest->note->GetFormID(), a_quest);
+    }
+
+    INFO("System::Supersede :: Running quest: '{}' now uses its reloaded record.", a_quest->name);
+}
+
+void System::UpdateGlobals(RE::BGSLocation* a_location)
+{
+    // Most calls find the mask unchanged, so that check runs under the shared lock; maskLock covers
+    // the per-location cache the lookup fills. Only a changed mask takes the lock exclusively.
+    {
+        std::shared_lock lock(catalogueLock);
+        std::unique_lock maskGuard(maskLock);
+
+        if (currentMask == catalogue.GetLocationMask(a_location)) {
+            return;
+        }
+    }
+
+    std::unique_lock lock(catalogueLock);
+
+    // Looked up again: a reload may have replaced the masks while no lock was held.
+    const auto mask = catalogue.GetLocationMask(a_location);
+
+    if (currentMask == mask) {
+        return;
+    }
+
+    currentMask = mask;
+
+    for (std::size_t type = 0; type < globals.size(); type++) {
+        if (const auto global = globals[type]; global) {
+            global->value = (mask & (1U << type)) ? 1U : 0U;
         }
     }
 }
 
-void System::UpdateLocationAlias(RE::TESQuest* a_quest, RE::BGSLocation* a_location)
+void System::UpdateLocationAlias(RE::TESQuest* a_quest, RE::BGSLocation* a_location, std::stop_token a_token)
 {
     if (a_quest && a_location) {
         for (auto& alias : a_quest->aliases) {
@@ -421,18 +792,24 @@ void System::UpdateLocationAlias(RE::TESQuest* a_quest, RE::BGSLocation* a_locat
 
                 a_quest->Stop();
 
-                INFO("System::UpdateLocationAlias :: Stopped quest: '{}' | '0x{:x}'", a_quest->GetName(), a_quest->GetFormID());
+                TRACE("System::UpdateLocationAlias :: Stopped quest: '{}' | '0x{:x}'", a_quest->GetName(), a_quest->GetFormID());
                 
                 if (locationAlias) {
+                    const auto isFilled = [a_quest, locationAlias]() { return !a_quest->IsStopped() && locationAlias->unk28; };
+
                     std::size_t counter = 5;
-                    while ((a_quest->IsStopped() || !locationAlias->unk28) && counter > 0) {
-                        INFO("System::UpdateLocationAlias :: Attempting to set alias: '{}' on: '{}' | '0x{:x} with location: '{}' | '0x{:x}' Tries left: '{}'", alias->aliasID, a_quest->GetName(), a_quest->GetFormID(), a_location->GetName(), a_location->GetFormID(), counter);
+                    while (counter > 0 && !a_token.stop_requested()) {
+                        PROFILE_ZONE("System::UpdateLocationAlias::Attempt");
+                        TRACE("System::UpdateLocationAlias :: Attempting to set alias: '{}' on: '{}' | '0x{:x} with location: '{}' | '0x{:x}' Tries left: '{}'", alias->aliasID, a_quest->GetName(), a_quest->GetFormID(), a_location->GetName(), a_location->GetFormID(), counter);
                         a_quest->Stop();
                         locationAlias->unk28 = reinterpret_cast<std::uint64_t>(a_location);
                         bool result;
                         a_quest->EnsureQuestStarted(result, false);
                         counter--;
-                        std::this_thread::sleep_for(std::chrono::milliseconds(250));
+
+                        if (WaitUntil(isFilled, std::chrono::milliseconds(250), a_token)) {
+                            break;
+                        }
                     }
                 }
             }
@@ -441,25 +818,55 @@ void System::UpdateLocationAlias(RE::TESQuest* a_quest, RE::BGSLocation* a_locat
         INFO("System::UpdateLocationAlias :: Invalid quest or location!");
     }
 }
+
 void System::UpdateReward(RE::TESQuest* a_quest, std::uint16_t a_index)
 {
-    for (auto& quest : quests) {
-        if (quest->quest == a_quest && quest->objectiveIndex == a_index) {
+    const auto objective = Serialization::GetSingleton()->GetObjective(a_quest, a_index);
+    const auto quest = objective ? GetQuest(a_quest, objective->location) : nullptr;
 
-            CompleteObjective(quest->region, quest->objectiveIndex);
+    if (quest && quest->objectiveIndex == a_index) {
+        CompleteObjective(quest->region, quest->objectiveIndex);
 
-            Serialization::GetSingleton()->ReserveLocation(quest->location, false);
-            Serialization::GetSingleton()->SetTracker(quest->region, quest->difficulty, 1U);
+        Serialization::GetSingleton()->ReserveLocation(quest->location, false);
+        Serialization::GetSingleton()->SetTracker(quest->region, quest->difficulty, 1U);
 
-            for (auto& objective : quest->quest->objectives) {
-                if (objective->index == 0 && !objective->state.any(RE::QUEST_OBJECTIVE_STATE::kDisplayed)) {
-                    SetObjectiveState(objective, RE::QUEST_OBJECTIVE_STATE::kDisplayed);
-                }
+        // A quest withdrawn by a reload while it was running is only kept until now.
+        ReleaseQuest(quest);
+
+        for (auto& instance : quest->quest->objectives) {
+            if (instance->index == 0 && !instance->state.any(RE::QUEST_OBJECTIVE_STATE::kDisplayed)) {
+                SetObjectiveState(instance, RE::QUEST_OBJECTIVE_STATE::kDisplayed);
             }
+        }
+    }
+}
+
+bool System::WaitUntil(std::function<bool()> a_condition, std::chrono::milliseconds a_timeout, std::stop_token a_token)
+{
+    const auto task = SKSE::GetTaskInterface();
+    const auto deadline = std::chrono::steady_clock::now() + a_timeout;
 
-            break;
+    // Evaluates the condition once per frame on the main thread until it holds or the deadline passes.
+    while (!a_token.stop_requested()) {
+        auto promise = std::make_shared<std::promise<bool>>();
+        auto result = promise->get_future();
+
+        task->AddTask([promise, a_condition]() { promise->set_value(a_condition()); });
+
+        if (result.wait_until(deadline) != std::future_status::ready) {
+            return false;
+        }
+
+        if (result.get()) {
+            return true;
+        }
+
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
         }
     }
+
+    return false;
 }
 
 void System::ForceLocationTo(RE::TESQuest* a_quest, std::uint32_t a_aliasID, RE::BGSLocation* a_location)
@@ -0,0 +1,74 @@
+#include "Trace.h"
+
+#ifdef BQRNG_PROFILE
+
+void Trace::Record(const char* a_name, std::chrono::steady_clock::time_point a_start, std::chrono::steady_clock::time_point a_end)
+{
+    auto& buffer = GetBuffer();
+    std::unique_lock lock(buffer.lock);
+
+    if (buffer.events.size() < kCapacity) {
+        buffer.events.emplace_back(a_name, a_start - origin, a_end - a_start);
+    }
+}
+
+auto Trace::Write() -> std::optional<std::filesystem::path>
+{
+    auto path = SKSE::log::log_directory();
+
+    if (!path) {
+        return std::nullopt;
+    }
+
+    *path /= std::format("{} Trace.json", SKSE::PluginDeclaration::GetSingleton()->GetName());
+
+    std::ofstream stream(*path, std::ios::trunc);
+
+    if (!stream) {
+        WARN("Trace::Write :: Failed to open: '{}'", path->string());
+        return std::nullopt;
+    }
+
+    std::vector<std::shared_ptr<Buffer>> snapshot;
+    {
+        std::unique_lock lock(this->lock);
+        snapshot = buffers;
+    }
+
+    const auto toMicroseconds = [](std::chrono::nanoseconds a_value) { return static_cast<double>(a_value.count()) / 1000.0; };
+
+    std::size_t count = 0;
+    stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    for (const auto& buffer : snapshot) {
+        std::unique_lock lock(buffer->lock);
+
+        for (const auto& event : buffer->events) {
+            stream << std::format("{}{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}", count++ ? "," : "", event.name, buffer->thread, toMicroseconds(event.start), toMicroseconds(event.duration));
+        }
+    }
+
+    stream << "]}\n";
+
+    INFO("Trace::Write :: Wrote '{}' zones to: '{}'", count, path->string());
+
+    return path;
+}
+
+auto Trace::GetBuffer() -> Buffer&
+{
+    thread_local std::shared_ptr<Buffer> buffer;
+
+    if (!buffer) {
+        buffer = std::make_shared<Buffer>();
+        buffer->events.reserve(1024);
+
+        std::unique_lock lock(this->lock);
+        buffer->thread = static_cast<std::uint32_t>(buffers.size() + 1);
+        buffers.push_back(buffer);
+    }
+
+    return *buffer;
+}
+
+#endif
@@ -1,26 +1,32 @@
 #include "Util.h"
 
-auto Util::GetDifficulty(std::string a_string) -> Util::DIFFICULTY
+namespace
 {
-    std::transform(std::begin(a_string), std::end(a_string), std::begin(a_string), [](unsigned char c)->unsigned char { return static_cast<unsigned char>(std::tolower(c)); });
-    if (a_string == "novice") {
-        return DIFFICULTY::Novice;
-    } else if (a_string == "apprentice") {
-        return DIFFICULTY::Apprentice;
-    } else if (a_string == "adept") {
-        return DIFFICULTY::Adept;
-    } else if (a_string == "expert") {
-        return DIFFICULTY::Expert;
-    } else if (a_string == "master") {
-        return DIFFICULTY::Master;
-    } else if (a_string == "legendary") {
-        return DIFFICULTY::Legendary;
-    } else {
-        return DIFFICULTY::None;
+    template <class T, std::size_t N>
+    constexpr bool RoundTrips(const std::array<std::pair<std::string_view, T>, N>& a_table, T (*a_parse)(std::string_view))
+    {
+        for (std::uint32_t i = 1; i <= N; i++) {
+            if (a_parse(Util::GetName(a_table, static_cast<T>(i))) != static_cast<T>(i)) {
+                return false;
+            }
+        }
+        return true;
     }
+
+    constexpr auto IsSorted = [](const auto& a_table) {
+        return std::is_sorted(a_table.begin(), a_table.end(), [](const auto& a_lhs, const auto& a_rhs) { return a_lhs.first < a_rhs.first; });
+    };
+
+    static_assert(IsSorted(Util::Difficulties));
+    static_assert(IsSorted(Util::Types));
+    static_assert(RoundTrips(Util::Difficulties, &Util::GetDifficulty));
+    static_assert(RoundTrips(Util::Types, &Util::GetType));
+    static_assert(Util::GetType("Bandit") == Util::TYPE::Bandit && Util::GetType("VAMPIRE") == Util::TYPE::Vampire);
+    static_assert(Util::GetType("bandits") == Util::TYPE::None && Util::GetType("") == Util::TYPE::None);
+    static_assert(Util::GetDifficulty("Legendary") == Util::DIFFICULTY::Legendary && Util::GetDifficulty("nov") == Util::DIFFICULTY::None);
 }
 
-auto Util::GetDifficulty(Util::DIFFICULTY a_difficulty) -> std::string
+auto Util::GetDifficulty(Util::DIFFICULTY a_difficulty) const -> std::string_view
 {
     switch (a_difficulty) {
     case DIFFICULTY::Novice:
@@ -56,43 +62,17 @@ auto Util::GetQuest(RE::FormID a_formID, std::string a_modName) const -> RE::TES
     return RE::TESDataHandler::GetSingleton()->LookupForm<RE::TESQuest>(a_formID, a_modName);
 }
 
-auto Util::GetText(Util::TEXT a_text) -> std::string
-{
-    return text[a_text];
-}
-
-auto Util::GetType(std::string a_string) -> Util::TYPE
+auto Util::GetText(Util::TEXT a_text) const -> std::string_view
 {
-    std::transform(std::begin(a_string), std::end(a_string), std::begin(a_string), [](unsigned char c)->unsigned char { return static_cast<unsigned char>(std::tolower(c)); });
-    if (a_string == "bandit") {
-        return TYPE::Bandit;
-    } else if (a_string == "dragon") {
-        return TYPE::Dragon;
-    } else if (a_string == "draugr") {
-        return TYPE::Draugr;
-    } else if (a_string == "dwemer") {
-        return TYPE::Dwemer;
-    } else if (a_string == "falmer") {
-        return TYPE::Falmer;
-    } else if (a_string == "forsworn") {
-        return TYPE::Forsworn;
-    } else if (a_string == "giant") {
-        return TYPE::Giant;
-    } else if (a_string == "mage") {
-        return TYPE::Mage;
-    } else if (a_string == "reaver") {
-        return TYPE::Reaver;
-    } else if (a_string == "riekling") {
-        return TYPE::Riekling;
-    } else if (a_string == "vampire") {
-        return TYPE::Vampire;
-    } else {
-        return TYPE::None;
-    }
+    const auto index = static_cast<std::size_t>(a_text);
+    return index < text.size() ? std::string_view(text[index]) : std::string_view();
 }
 
 void Util::SetText(Util::TEXT a_text, std::string a_string)
 {
     INFO("Util::SetText :: Parsed text: '{}'", a_string);
-    text.try_emplace(a_text, a_string);
+
+    if (const auto index = static_cast<std::size_t>(a_text); index < text.size() && text[index].empty()) {
+        text[index] = std::move(a_string);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,150 @@
+#include "Binary.h"
+#include "Test.h"
+
+#include <array>
+#include <limits>
+
+namespace
+{
+    enum class Small : std::uint8_t
+    {
+        First = 1,
+        Last = 0xFF
+    };
+
+    enum class Signed : std::int32_t
+    {
+        Negative = -2,
+        Positive = 7
+    };
+
+    auto Bytes(std::string_view a_string) -> std::span<const std::byte>
+    {
+        return { reinterpret_cast<const std::byte*>(a_string.data()), a_string.size() };
+    }
+}
+
+TEST(BinaryIntegersRoundTrip)
+{
+    Binary::Writer writer;
+    writer.Write(std::uint8_t{ 0xAB });
+    writer.Write(std::int16_t{ -12345 });
+    writer.Write(std::uint32_t{ 0xDEADBEEF });
+    writer.Write(std::numeric_limits<std::int64_t>::min());
+    writer.Write(std::numeric_limits<std::uint64_t>::max());
+
+    CHECK(writer.GetData().size() == 1 + 2 + 4 + 8 + 8);
+
+    Binary::Reader reader(writer.GetData());
+    std::uint8_t a = 0;
+    std::int16_t b = 0;
+    std::uint32_t c = 0;
+    std::int64_t d = 0;
+    std::uint64_t e = 0;
+
+    CHECK(reader.Read(a) && a == 0xAB);
+    CHECK(reader.Read(b) && b == -12345);
+    CHECK(reader.Read(c) && c == 0xDEADBEEF);
+    CHECK(reader.Read(d) && d == std::numeric_limits<std::int64_t>::min());
+    CHECK(reader.Read(e) && e == std::numeric_limits<std::uint64_t>::max());
+    CHECK(reader.IsEnd());
+}
+
+TEST(BinaryIsLittleEndian)
+{
+    Binary::Writer writer;
+    writer.Write(std::uint32_t{ 0x04030201 });
+
+    const auto& data = writer.GetData();
+    CHECK(data.size() == 4);
+    CHECK(data[0] == std::byte{ 1 } && data[1] == std::byte{ 2 } && data[2] == std::byte{ 3 } && data[3] == std::byte{ 4 });
+}
+
+TEST(BinaryEnumsRoundTrip)
+{
+    Binary::Writer writer;
+    writer.Write(Small::Last);
+    writer.Write(Signed::Negative);
+    writer.Write(Signed::Positive);
+
+    CHECK(writer.GetData().size() == 1 + 4 + 4);
+
+    Binary::Reader reader(writer.GetData());
+    Small small{};
+    Signed negative{};
+    Signed positive{};
+
+    CHECK(reader.Read(small) && small == Small::Last);
+    CHECK(reader.Read(negative) && negative == Signed::Negative);
+    CHECK(reader.Read(positive) && positive == Signed::Positive);
+    CHECK(reader.IsEnd());
+}
+
+TEST(BinaryVarintsRoundTrip)
+{
+    constexpr std::array<std::uint64_t, 8> values{ 0, 1, 0x7F, 0x80, 0x3FFF, 0x4000, 0xFFFFFFFF, std::numeric_limits<std::uint64_t>::max() };
+
+    Binary::Writer writer;
+    for (const auto value : values) {
+        writer.WriteVarint(value);
+    }
+
+    Binary::Reader reader(writer.GetData());
+    for (const auto value : values) {
+        std::uint64_t read = 0;
+        CHECK(reader.ReadVarint(read) && read == value);
+    }
+    CHECK(reader.IsEnd());
+}
+
+TEST(BinaryStringsRoundTrip)
+{
+    Binary::Writer writer;
+    writer.WriteString("");
+    writer.WriteString("Bleak Falls Barrow");
+    writer.WriteString(std::string(300, 'x'));
+
+    Binary::Reader reader(writer.GetData());
+    std::string string;
+
+    CHECK(reader.ReadString(string) && string.empty());
+    CHECK(reader.ReadString(string) && string == "Bleak Falls Barrow");
+    CHECK(reader.ReadString(string) && string == std::string(300, 'x'));
+    CHECK(reader.IsEnd());
+}
+
+TEST(BinaryRejectsTruncatedInput)
+{
+    Binary::Writer writer;
+    writer.Write(std::uint32_t{ 42 });
+    writer.WriteVarint(1U << 20);
+    writer.WriteString("truncated");
+
+    const auto& data = writer.GetData();
+
+    for (std::size_t size = 0; size < data.size(); size++) {
+        Binary::Reader reader(std::span(data.data(), size));
+        std::uint32_t value = 0;
+        std::uint64_t varint = 0;
+        std::string string;
+
+        CHECK(!(reader.Read(value) && reader.ReadVarint(varint) && reader.ReadString(string)));
+    }
+}
+
+TEST(BinaryRejectsOverlongVarint)
+{
+    const std::string data(11, '\xFF');
+
+    Binary::Reader reader(Bytes(data));
+    std::uint64_t value = 0;
+
+    CHECK(!reader.ReadVarint(value));
+}
+
+TEST(BinaryHashIsFnv1a)
+{
+    CHECK(Binary::Hash({}) == 14695981039346656037ULL);
+    CHECK(Binary::Hash(Bytes("a")) == 0xAF63DC4C8601EC8CULL);
+    CHECK(Binary::Hash(Bytes("foobar")) == 0x85944171F73967E8ULL);
+}
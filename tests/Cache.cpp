@@ -0,0 +1,117 @@
+#include "Cache.h"
+#include "Test.h"
+
+namespace
+{
+    struct Contents
+    {
+        Cache::Quests quests;
+        std::vector<Entries::Reward> rewards;
+        std::vector<Entries::Tracker> trackers;
+        std::vector<Entries::Text> texts;
+    };
+
+    const std::vector<Cache::Source> Sources{
+        { "C:/Data/Quests/Base.json", 2048, 133000000000000000, 0x1234 },
+        { "C:/Data/Quests/Extra.json", 512, 133000000000000001, 0x5678 },
+        { "C:/Data/Rewards.json", 128, 133000000000000002, 0x9ABC }
+    };
+
+    auto MakeQuest(std::string a_name, std::string a_file) -> Entries::Quest
+    {
+        return { std::move(a_name), "Adept", { 0x1A2B, "Skyrim.esm" }, { 0x100, "Skyrim.esm" }, { 0x800, "Bounty Quests Redone - NG.esl" }, "Draugr", std::move(a_file) };
+    }
+
+    auto MakeContents() -> Contents
+    {
+        Contents contents;
+        contents.quests["C:/Data/Quests/Base.json"] = { MakeQuest("Bleak Falls Barrow", "C:/Data/Quests/Base.json"), MakeQuest("Embershard Mine", "C:/Data/Quests/Base.json") };
+        contents.quests["C:/Data/Quests/Extra.json"] = { MakeQuest("Saarthal", "C:/Data/Quests/Extra.json") };
+        contents.rewards.push_back({ { 0xF, "Skyrim.esm" }, { { Tables::DIFFICULTY::Novice, 100 }, { Tables::DIFFICULTY::Legendary, 1500 } } });
+        contents.trackers.push_back({ { 0xD01, "Bounty Quests Redone - NG.esl" }, { 0x100, "Skyrim.esm" } });
+        contents.texts.push_back({ Tables::TEXT::Objective, "Clear out %l" });
+        contents.texts.push_back({ Tables::TEXT::Adept, "Adept" });
+        return contents;
+    }
+
+    auto Encode(const std::vector<Cache::Source>& a_sources, const Contents& a_contents) -> std::vector<std::byte>
+    {
+        Binary::Writer writer;
+        Cache::Encode(writer, a_sources, a_contents.quests, a_contents.rewards, a_contents.trackers, a_contents.texts);
+        return writer.GetData();
+    }
+
+    bool Decode(std::span<const std::byte> a_data, const std::vector<Cache::Source>& a_sources, Contents& a_contents)
+    {
+        Binary::Reader reader(a_data);
+        return Cache::Decode(reader, a_sources, a_contents.quests, a_contents.rewards, a_contents.trackers, a_contents.texts);
+    }
+
+    bool IsEmpty(const Contents& a_contents)
+    {
+        return a_contents.quests.empty() && a_contents.rewards.empty() && a_contents.trackers.empty() && a_contents.texts.empty();
+    }
+}
+
+TEST(CacheRoundTripsEveryRecord)
+{
+    const auto expected = MakeContents();
+    const auto data = Encode(Sources, expected);
+
+    Contents actual;
+    CHECK(Decode(data, Sources, actual));
+    CHECK(actual.quests == expected.quests);
+    CHECK(actual.rewards.size() == 1 && actual.rewards.front().form == expected.rewards.front().form && actual.rewards.front().amount == expected.rewards.front().amount);
+    CHECK(actual.trackers.size() == 1 && actual.trackers.front().global == expected.trackers.front().global && actual.trackers.front().region == expected.trackers.front().region);
+    CHECK(actual.texts.size() == 2 && actual.texts[1].text == Tables::TEXT::Adept && actual.texts[0].value == "Clear out %l");
+}
+
+TEST(CacheRejectsTruncatedData)
+{
+    const auto data = Encode(Sources, MakeContents());
+
+    for (std::size_t length = 0; length < data.size(); length++) {
+        Contents contents = MakeContents();
+        CHECK(!Decode(std::span(data).first(length), Sources, contents));
+        CHECK(IsEmpty(contents));
+    }
+
+    auto padded = data;
+    padded.push_back(std::byte{ 0 });
+
+    Contents contents;
+    CHECK(!Decode(padded, Sources, contents));
+}
+
+TEST(CacheRejectsStaleSources)
+{
+    const auto data = Encode(Sources, MakeContents());
+
+    auto edited = Sources;
+    edited[1].hash ^= 1;
+
+    auto added = Sources;
+    added.push_back({ "C:/Data/Quests/New.json", 64, 133000000000000003, 0xDEF0 });
+
+    auto removed = Sources;
+    removed.erase(removed.begin());
+
+    for (const auto& sources : { edited, added, removed }) {
+        Contents contents;
+        CHECK(!Decode(data, sources, contents));
+        CHECK(IsEmpty(contents));
+    }
+}
+
+TEST(CacheRejectsOtherVersions)
+{
+    auto data = Encode(Sources, MakeContents());
+    data[4] = std::byte{ Cache::Version + 1 };
+
+    Contents contents;
+    CHECK(!Decode(data, Sources, contents));
+
+    data[4] = std::byte{ Cache::Version };
+    data[0] = std::byte{ 0 };
+    CHECK(!Decode(data, Sources, contents));
+}
@@ -0,0 +1,262 @@
+#include "Catalogue.h"
+#include "Tables.h"
+#include "Test.h"
+
+#include <array>
+#include <string>
+
+namespace
+{
+    // Stand-ins for BGSLocation / TESQuest and System::Quest with only what Catalogue::Index reads.
+    struct Location
+    {
+        Location* parentLoc;
+    };
+
+    struct Owner
+    {};
+
+    struct Quest
+    {
+        Owner* quest;
+        Location* location;
+        Location* region;
+        Tables::TYPE type;
+        Tables::DIFFICULTY difficulty;
+        std::string name;
+    };
+
+    auto MakeQuest(Owner* a_owner, Location* a_location, Location* a_region, Tables::TYPE a_type, Tables::DIFFICULTY a_difficulty, std::string a_name) -> std::shared_ptr<Quest>
+    {
+        return std::make_shared<Quest>(a_owner, a_location, a_region, a_type, a_difficulty, std::move(a_name));
+    }
+
+    constexpr std::array<double, 7> Weights{ 0.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+}
+
+static_assert(Tables::GetType("Bandit") == Tables::TYPE::Bandit);
+static_assert(Tables::GetType("VAMPIRE") == Tables::TYPE::Vampire);
+static_assert(Tables::GetType("banditt") == Tables::TYPE::None);
+static_assert(Tables::GetDifficulty("legendary") == Tables::DIFFICULTY::Legendary);
+static_assert(Tables::GetDifficulty("") == Tables::DIFFICULTY::None);
+static_assert(Tables::GetName(Tables::Types, Tables::TYPE::Draugr) == "draugr");
+static_assert(Tables::GetName(Tables::Types, Tables::TYPE::None) == "none");
+
+TEST(CatalogueIndexesByRegionAndType)
+{
+    Location hold{ nullptr };
+    Location cave{ &hold };
+    Location fort{ &hold };
+    Owner owner;
+
+    Catalogue::Index<Quest> catalogue;
+    catalogue.Add(MakeQuest(&owner, &cave, &hold, Tables::TYPE::Bandit, Tables::DIFFICULTY::Novice, "Cave"));
+    catalogue.Add(MakeQuest(&owner, &fort, &hold, Tables::TYPE::Forsworn, Tables::DIFFICULTY::Adept, "Fort"));
+
+    CHECK(catalogue.GetQuests().size() == 2);
+    CHECK(catalogue.GetQuests(&hold).size() == 2);
+    CHECK(catalogue.GetQuests(&hold, Tables::TYPE::Bandit).size() == 1);
+    CHECK(catalogue.GetQuests(&hold, Tables::TYPE::Dragon).empty());
+    CHECK(catalogue.GetQuests(&cave).empty());
+    CHECK(catalogue.GetRegionCount() == 1);
+    CHECK(catalogue.GetOwners(&hold).size() == 1);
+    CHECK(catalogue.IsOwner(&owner));
+    CHECK(catalogue.Contains(&fort));
+    CHECK(catalogue.GetQuest(&owner, &fort)->name == "Fort");
+    CHECK(catalogue.GetQuest(nullptr, &fort) == nullptr);
+}
+
+TEST(CatalogueLocationMaskWalksParents)
+{
+    Location hold{ nullptr };
+    Location city{ &hold };
+    Location house{ &city };
+    Owner owner;
+
+    Catalogue::Index<Quest> catalogue;
+    catalogue.Add(MakeQuest(&owner, &house, &hold, Tables::TYPE::Bandit, Tables::DIFFICULTY::Novice, "Hold"));
+    catalogue.Add(MakeQuest(&owner, &house, &city, Tables::TYPE::Mage, Tables::DIFFICULTY::Novice, "City"));
+
+    const auto bandit = 1U << static_cast<std::uint32_t>(Tables::TYPE::Bandit);
+    const auto mage = 1U << static_cast<std::uint32_t>(Tables::TYPE::Mage);
+
+    CHECK(catalogue.GetLocationMask(&house) == (bandit | mage));
+    CHECK(catalogue.GetLocationMask(&hold) == bandit);
+
+    // The cached mask goes stale until ClearMasks, which is what System relies on after a reload.
+    catalogue.Remove(&city, [](const Quest&) { return true; }, false);
+    CHECK(catalogue.GetLocationMask(&house) == (bandit | mage));
+
+    catalogue.ClearMasks();
+    CHECK(catalogue.GetLocationMask(&house) == bandit);
+}
+
+TEST(CatalogueRemoveUpdatesTypesAndLocations)
+{
+    Location hold{ nullptr };
+    Location cave{ &hold };
+    Owner first;
+    Owner second;
+
+    Catalogue::Index<Quest> catalogue;
+    catalogue.Add(MakeQuest(&first, &cave, &hold, Tables::TYPE::Bandit, Tables::DIFFICULTY::Novice, "First"));
+    catalogue.Add(MakeQuest(&second, &cave, &hold, Tables::TYPE::Bandit, Tables::DIFFICULTY::Novice, "Second"));
+
+    const auto removed = catalogue.Remove(&hold, [](const Quest& a_quest) { return a_quest.name == "First"; }, false);
+
+    CHECK(removed && removed->name == "First");
+    CHECK(catalogue.GetQuests().size() == 1);
+    CHECK(catalogue.GetQuests(&hold, Tables::TYPE::Bandit).size() == 1);
+    CHECK(catalogue.GetQuest(&first, &cave) == nullptr);
+    CHECK(catalogue.GetQuest(&second, &cave)->name == "Second");
+
+    catalogue.Remove(&hold, [](const Quest&) { return true; }, false);
+    catalogue.ClearMasks();
+
+    CHECK(catalogue.GetQuests(&hold).empty());
+    CHECK(catalogue.GetQuests(&hold, Tables::TYPE::Bandit).empty());
+    CHECK(catalogue.GetLocationMask(&cave) == 0U);
+    CHECK(catalogue.Remove(&cave, [](const Quest&) { return true; }, false) == nullptr);
+}
+
+TEST(CatalogueRemoveRetainsRunningQuest)
+{
+    Location hold{ nullptr };
+    Location cave{ &hold };
+    Owner owner;
+
+    Catalogue::Index<Quest> catalogue;
+    const auto quest = MakeQuest(&owner, &cave, &hold, Tables::TYPE::Bandit, Tables::DIFFICULTY::Novice, "Cave");
+    catalogue.Add(quest);
+
+    CHECK(catalogue.Remove(&hold, [](const Quest&) { return true; }, true) == quest);
+    CHECK(catalogue.GetQuests(&hold).empty());
+    CHECK(catalogue.GetQuest(&owner, &cave) == quest);
+    CHECK(catalogue.IsRetained(quest));
+    CHECK(catalogue.IsOwner(&owner));
+    CHECK(catalogue.GetOwners(&hold).size() == 1);
+
+    // Completing the running quest drops every remaining entry.
+    CHECK(catalogue.Release(quest));
+    CHECK(!catalogue.Release(quest));
+    CHECK(catalogue.GetQuest(&owner, &cave) == nullptr);
+    CHECK(!catalogue.Contains(&cave));
+    CHECK(!catalogue.IsOwner(&owner));
+    CHECK(catalogue.GetOwners(&hold).empty());
+}
+
+TEST(CatalogueReaddSupersedesRetainedQuest)
+{
+    Location hold{ nullptr };
+    Location reach{ nullptr };
+    Location cave{ &hold };
+    Owner owner;
+
+    Catalogue::Index<Quest> catalogue;
+    const auto original = MakeQuest(&owner, &cave, &hold, Tables::TYPE::Bandit, Tables::DIFFICULTY::Novice, "Cave");
+    catalogue.Add(original);
+    catalogue.Remove(&hold, [](const Quest&) { return true; }, true);
+
+    // The pack changed the quest's region and difficulty while it was running.
+    const auto changed = MakeQuest(&owner, &cave, &reach, Tables::TYPE::Bandit, Tables::DIFFICULTY::Expert, "Cave");
+
+    CHECK(catalogue.Add(changed) == original);
+    CHECK(catalogue.GetQuest(&owner, &cave) == changed);
+    CHECK(!catalogue.IsRetained(original));
+    CHECK(catalogue.GetOwners(&hold).empty());
+    CHECK(catalogue.GetOwners(&reach).size() == 1);
+    CHECK(catalogue.GetQuests().size() == 1);
+
+    // A plain re-add of a quest that is not running supersedes nothing but still wins the lookup.
+    const auto another = MakeQuest(&owner, &cave, &reach, Tables::TYPE::Mage, Tables::DIFFICULTY::Adept, "Cave");
+
+    CHECK(catalogue.Add(another) == nullptr);
+    CHECK(catalogue.GetQuest(&owner, &cave) == another);
+
+    catalogue.Remove(&reach, [&another](const Quest& a_quest) { return &a_quest == another.get(); }, false);
+
+    CHECK(catalogue.GetQuest(&owner, &cave) == changed);
+    CHECK(catalogue.IsOwner(&owner));
+}
+
+TEST(CatalogueRemovePrunesOwners)
+{
+    Location hold{ nullptr };
+    Location cave{ &hold };
+    Location fort{ &hold };
+    Owner first;
+    Owner second;
+
+    Catalogue::Index<Quest> catalogue;
+    catalogue.Add(MakeQuest(&first, &cave, &hold, Tables::TYPE::Bandit, Tables::DIFFICULTY::Novice, "Cave"));
+    catalogue.Add(MakeQuest(&first, &fort, &hold, Tables::TYPE::Bandit, Tables::DIFFICULTY::Novice, "Fort"));
+    catalogue.Add(MakeQuest(&second, &fort, &hold, Tables::TYPE::Mage, Tables::DIFFICULTY::Novice, "Tower"));
+
+    catalogue.Remove(&hold, [](const Quest& a_quest) { return a_quest.name == "Tower"; }, false);
+
+    CHECK(!catalogue.IsOwner(&second));
+    CHECK((catalogue.GetOwners(&hold) == std::vector<Owner*>{ &first }));
+
+    catalogue.Remove(&hold, [](const Quest& a_quest) { return a_quest.name == "Cave"; }, false);
+    CHECK(catalogue.IsOwner(&first));
+
+    catalogue.Remove(&hold, [](const Quest&) { return true; }, false);
+    CHECK(!catalogue.IsOwner(&first));
+    CHECK(catalogue.GetRegionCount() == 0);
+}
+
+TEST(CatalogueSamplersFollowWeights)
+{
+    Location hold{ nullptr };
+    Location cave{ &hold };
+    Location fort{ &hold };
+    Owner owner;
+
+    Catalogue::Index<Quest> catalogue;
+    catalogue.Add(MakeQuest(&owner, &cave, &hold, Tables::TYPE::Bandit, Tables::DIFFICULTY::None, "Unweighted"));
+    catalogue.Add(MakeQuest(&owner, &fort, &hold, Tables::TYPE::Bandit, Tables::DIFFICULTY::Master, "Weighted"));
+    catalogue.BuildSamplers(Weights);
+
+    const auto sampler = catalogue.GetSampler(&hold, Tables::TYPE::None);
+    const auto typed = catalogue.GetSampler(&hold, Tables::TYPE::Bandit);
+
+    CHECK(sampler && sampler->GetSize() == 2);
+    CHECK(typed && typed->GetSize() == 2);
+    CHECK(catalogue.GetSampler(&hold, Tables::TYPE::Dragon) == nullptr);
+    CHECK(catalogue.GetSampler(&cave, Tables::TYPE::None) == nullptr);
+
+    Random::PCG32 random;
+    random.Seed(42);
+
+    // A zero-weight difficulty is never drawn.
+    for (std::size_t i = 0; i < 256; i++) {
+        CHECK(catalogue.GetQuests(&hold)[sampler->Sample(random)]->name == "Weighted");
+    }
+}
+
+TEST(CatalogueRemoveKeepsPositionsConsistent)
+{
+    Location hold{ nullptr };
+    Owner owner;
+    std::vector<Location> locations(16, Location{ &hold });
+
+    Catalogue::Index<Quest> catalogue;
+    for (std::size_t i = 0; i < locations.size(); i++) {
+        catalogue.Add(MakeQuest(&owner, &locations[i], &hold, Tables::TYPE::Bandit, Tables::DIFFICULTY::Novice, std::to_string(i)));
+    }
+
+    // Remove from the front, the back and the middle so every swap-and-pop branch runs.
+    for (const auto name : { "0", "15", "7", "1", "14" }) {
+        CHECK(catalogue.Remove(&hold, [name](const Quest& a_quest) { return a_quest.name == name; }, false) != nullptr);
+    }
+
+    CHECK(catalogue.GetQuests().size() == 11);
+    CHECK(catalogue.GetQuests(&hold).size() == 11);
+
+    for (const auto& quest : catalogue.GetQuests(&hold)) {
+        CHECK(std::ranges::count(catalogue.GetQuests(), quest) == 1);
+    }
+
+    while (catalogue.Remove(&hold, [](const Quest&) { return true; }, false)) {}
+    CHECK(catalogue.GetQuests().empty());
+}
@@ -0,0 +1,183 @@
+#include "Entries.h"
+#include "Test.h"
+
+#include <initializer_list>
+
+namespace
+{
+    enum class Event
+    {
+        Object,
+        Array,
+        End,
+        Key,
+        Value
+    };
+
+    // Replays what the jsoncons cursor would emit for a document, as (event, text) pairs.
+    template <class T, class F>
+    auto Build(std::string_view a_root, F a_field, std::initializer_list<std::pair<Event, std::string_view>> a_events) -> std::vector<T>
+    {
+        Entries::Builder<T, F> builder(a_root, a_field);
+
+        for (const auto& [event, text] : a_events) {
+            switch (event) {
+            case Event::Object:
+                builder.Begin(true);
+                break;
+            case Event::Array:
+                builder.Begin(false);
+                break;
+            case Event::End:
+                builder.End();
+                break;
+            case Event::Key:
+                builder.Key(text);
+                break;
+            case Event::Value:
+                builder.Value(text);
+                break;
+            }
+        }
+
+        return builder.Take();
+    }
+}
+
+TEST(EntriesBuildsQuestsFromEvents)
+{
+    const auto quests = Build<Entries::Quest>("Quests", Entries::ReadQuest, {
+        { Event::Object, "" },
+        { Event::Key, "Quests" },
+        { Event::Array, "" },
+        { Event::Object, "" },
+        { Event::Key, "LocationName" },
+        { Event::Value, "Bleak Falls Barrow" },
+        { Event::Key, "Difficulty" },
+        { Event::Value, "Adept" },
+        { Event::Key, "Type" },
+        { Event::Value, "Draugr" },
+        { Event::Key, "Location" },
+        { Event::Object, "" },
+        { Event::Key, "FormID" },
+        { Event::Value, "0x1A2B" },
+        { Event::Key, "ModName" },
+        { Event::Value, "Skyrim.esm" },
+        { Event::End, "" },
+        { Event::Key, "Region" },
+        { Event::Object, "" },
+        { Event::Key, "FormID" },
+        { Event::Value, "42" },
+        { Event::Key, "ModName" },
+        { Event::Value, "Skyrim.esm" },
+        { Event::End, "" },
+        { Event::Key, "Quest" },
+        { Event::Object, "" },
+        { Event::Key, "FormID" },
+        { Event::Value, "0x800" },
+        { Event::Key, "ModName" },
+        { Event::Value, "Bounty Quests Redone - NG.esl" },
+        { Event::End, "" },
+        { Event::End, "" },
+        { Event::Object, "" },
+        { Event::Key, "LocationName" },
+        { Event::Value, "Incomplete" },
+        { Event::End, "" },
+        { Event::End, "" },
+        { Event::End, "" },
+    });
+
+    CHECK(quests.size() == 2);
+    CHECK(quests[0].name == "Bleak Falls Barrow" && quests[0].difficulty == "Adept" && quests[0].type == "Draugr");
+    CHECK((quests[0].location == Entries::Form{ 0x1A2B, "Skyrim.esm" }));
+    CHECK((quests[0].region == Entries::Form{ 42, "Skyrim.esm" }));
+    CHECK((quests[0].quest == Entries::Form{ 0x800, "Bounty Quests Redone - NG.esl" }));
+    CHECK(Entries::IsValid(quests[0]));
+    CHECK(!Entries::IsValid(quests[1]));
+}
+
+TEST(EntriesIgnoresOtherRoots)
+{
+    const auto trackers = Build<Entries::Tracker>("Trackers", Entries::ReadTracker, {
+        { Event::Object, "" },
+        { Event::Key, "Rewards" },
+        { Event::Array, "" },
+        { Event::Object, "" },
+        { Event::Key, "GlobalVariable" },
+        { Event::Object, "" },
+        { Event::Key, "FormID" },
+        { Event::Value, "1" },
+        { Event::End, "" },
+        { Event::End, "" },
+        { Event::End, "" },
+        { Event::End, "" },
+    });
+
+    CHECK(trackers.empty());
+}
+
+TEST(EntriesReadsRewardQuantitiesAndTexts)
+{
+    const auto rewards = Build<Entries::Reward>("Rewards", Entries::ReadReward, {
+        { Event::Object, "" },
+        { Event::Key, "Rewards" },
+        { Event::Array, "" },
+        { Event::Object, "" },
+        { Event::Key, "FormID" },
+        { Event::Value, "0xF" },
+        { Event::Key, "ModName" },
+        { Event::Value, "Skyrim.esm" },
+        { Event::Key, "Quantity" },
+        { Event::Object, "" },
+        { Event::Key, "novice" },
+        { Event::Value, "100" },
+        { Event::Key, "Legendary" },
+        { Event::Value, "1500" },
+        { Event::Key, "Mythic" },
+        { Event::Value, "9" },
+        { Event::End, "" },
+        { Event::End, "" },
+        { Event::End, "" },
+        { Event::End, "" },
+    });
+
+    CHECK(rewards.size() == 1 && Entries::IsValid(rewards.front()));
+    CHECK(rewards.front().amount.size() == 2);
+    CHECK(rewards.front().amount.at(Tables::DIFFICULTY::Novice) == 100);
+    CHECK(rewards.front().amount.at(Tables::DIFFICULTY::Legendary) == 1500);
+
+    const auto texts = Build<std::vector<Entries::Text>>("Texts", Entries::ReadTexts, {
+        { Event::Object, "" },
+        { Event::Key, "Texts" },
+        { Event::Array, "" },
+        { Event::Object, "" },
+        { Event::Key, "Objective" },
+        { Event::Value, "Clear %l" },
+        { Event::Key, "Adept" },
+        { Event::Value, "Adept" },
+        { Event::Key, "Colour" },
+        { Event::Value, "Red" },
+        { Event::End, "" },
+        { Event::End, "" },
+        { Event::End, "" },
+    });
+
+    CHECK(texts.size() == 1 && texts.front().size() == 2);
+    CHECK(texts.front()[0].text == Tables::TEXT::Objective && texts.front()[0].value == "Clear %l");
+    CHECK(texts.front()[1].text == Tables::TEXT::Adept);
+}
+
+TEST(EntriesRejectsMalformedIntegers)
+{
+    CHECK(Entries::ToInteger<std::uint32_t>("0X10") == 16);
+
+    for (const auto value : { "", "0x", "12ab", "-1", "0x1G" }) {
+        bool threw = false;
+        try {
+            Entries::ToInteger<std::uint32_t>(value);
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        CHECK(threw);
+    }
+}
@@ -0,0 +1,18 @@
+#include "Test.h"
+
+int main()
+{
+    std::size_t failed = 0;
+
+    for (const auto& [name, body] : Test::GetCases()) {
+        const auto before = Test::GetFailures();
+        body();
+
+        const auto passed = Test::GetFailures() == before;
+        failed += passed ? 0 : 1;
+        std::printf("[%s] %.*s\n", passed ? "PASS" : "FAIL", static_cast<int>(name.size()), name.data());
+    }
+
+    std::printf("%zu of %zu tests passed.\n", Test::GetCases().size() - failed, Test::GetCases().size());
+    return failed ? 1 : 0;
+}
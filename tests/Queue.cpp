@@ -0,0 +1,78 @@
+#include "Queue.h"
+#include "Test.h"
+
+#include <cstdint>
+#include <thread>
+
+TEST(QueueDrainsInPushOrder)
+{
+    MPSCQueue<int> queue;
+    CHECK(queue.IsEmpty());
+
+    for (int i = 0; i < 5; i++) {
+        queue.Push(i);
+    }
+
+    CHECK(!queue.IsEmpty());
+    CHECK(queue.Drain() == std::vector<int>({ 0, 1, 2, 3, 4 }));
+    CHECK(queue.IsEmpty());
+    CHECK(queue.Drain().empty());
+}
+
+TEST(QueueStressMultipleProducers)
+{
+    constexpr std::uint32_t producers = 4;
+    constexpr std::uint32_t count = 100000;
+
+    MPSCQueue<std::uint64_t> queue;
+    std::atomic<bool> go{ false };
+    std::atomic<std::uint32_t> finished{ 0 };
+
+    std::vector<std::thread> threads;
+    for (std::uint32_t producer = 0; producer < producers; producer++) {
+        threads.emplace_back([&queue, &go, &finished, producer]() {
+            while (!go.load(std::memory_order_acquire)) {}
+            for (std::uint32_t i = 0; i < count; i++) {
+                queue.Push((static_cast<std::uint64_t>(producer) << 32) | i);
+            }
+            finished.fetch_add(1, std::memory_order_release);
+        });
+    }
+
+    // Each producer's values must arrive exactly once and in the order that producer pushed them.
+    std::vector<std::uint32_t> next(producers, 0);
+    std::uint64_t received = 0;
+    bool ordered = true;
+
+    const auto consume = [&](std::vector<std::uint64_t> a_batch) {
+        for (const auto value : a_batch) {
+            const auto producer = static_cast<std::uint32_t>(value >> 32);
+            const auto index = static_cast<std::uint32_t>(value);
+            if (producer >= producers || index != next[producer]) {
+                ordered = false;
+                continue;
+            }
+            next[producer]++;
+            received++;
+        }
+    };
+
+    go.store(true, std::memory_order_release);
+
+    while (finished.load(std::memory_order_acquire) < producers) {
+        consume(queue.Drain());
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    consume(queue.Drain());
+
+    CHECK(ordered);
+    CHECK(received == static_cast<std::uint64_t>(producers) * count);
+    for (std::uint32_t producer = 0; producer < producers; producer++) {
+        CHECK(next[producer] == count);
+    }
+    CHECK(queue.IsEmpty());
+}
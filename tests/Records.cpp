@@ -0,0 +1,278 @@
+#include "Records.h"
+#include "Test.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    // In-memory stand-in for SKSE::SerializationInterface: ReadRecordData copies what is left
+    // and reports how many bytes it actually produced.
+    class FakeInterface
+    {
+    public:
+        explicit FakeInterface(std::vector<std::byte> a_data) :
+            data(std::move(a_data))
+        {}
+
+        auto ReadRecordData(void* a_buffer, std::uint32_t a_length) -> std::uint32_t
+        {
+            const auto length = static_cast<std::uint32_t>(std::min<std::size_t>(a_length, data.size() - position));
+            if (length > 0) {
+                std::memcpy(a_buffer, data.data() + position, length);
+                position += length;
+            }
+            return length;
+        }
+
+        auto GetSize() const -> std::uint32_t { return static_cast<std::uint32_t>(data.size()); }
+    private:
+        std::vector<std::byte> data;
+        std::size_t position{ 0 };
+    };
+
+    // Builds the raw field-by-field layout written by version 1 saves.
+    class LegacyWriter
+    {
+    public:
+        template <class T>
+        void Write(T a_value)
+        {
+            const auto bytes = reinterpret_cast<const std::byte*>(&a_value);
+            data.insert(data.end(), bytes, bytes + sizeof(T));
+        }
+
+        void WriteString(std::string_view a_string)
+        {
+            Write<std::uint64_t>(a_string.size() + 1);
+            const auto bytes = reinterpret_cast<const std::byte*>(a_string.data());
+            data.insert(data.end(), bytes, bytes + a_string.size());
+            data.push_back(std::byte{ 0 });
+        }
+
+        std::vector<std::byte> data;
+    };
+
+    auto MakeObjectives() -> std::vector<Records::Objective>
+    {
+        return {
+            { 0x01000800, 0x00018A5D, 10, "Clear out Bleak Falls Barrow" },
+            { 0x01000801, 0x00018A5E, 20, "Clear out Embershard Mine" },
+            { 0x01000800, 0x00018A5F, 30, "Clear out Bleak Falls Barrow" }
+        };
+    }
+
+    auto MakeTrackers() -> std::vector<Records::Tracker>
+    {
+        return {
+            { 0x01000D62, 0x00016772, { { 1, 2 }, { 6, 1 } } },
+            { 0x01000D63, 0x00016773, {} }
+        };
+    }
+
+    bool Equal(const std::vector<Records::Objective>& a_lhs, const std::vector<Records::Objective>& a_rhs)
+    {
+        return std::ranges::equal(a_lhs, a_rhs, [](const auto& a_left, const auto& a_right) {
+            return a_left.quest == a_right.quest && a_left.location == a_right.location && a_left.index == a_right.index && a_left.text == a_right.text;
+        });
+    }
+
+    bool Equal(const std::vector<Records::Tracker>& a_lhs, const std::vector<Records::Tracker>& a_rhs)
+    {
+        return std::ranges::equal(a_lhs, a_rhs, [](const auto& a_left, const auto& a_right) {
+            return a_left.global == a_right.global && a_left.region == a_right.region && a_left.reward == a_right.reward;
+        });
+    }
+
+    auto Truncate(const std::vector<std::byte>& a_data, std::size_t a_size) -> std::vector<std::byte>
+    {
+        return { a_data.begin(), a_data.begin() + static_cast<std::ptrdiff_t>(a_size) };
+    }
+}
+
+TEST(RecordsObjectivesRoundTrip)
+{
+    const auto objectives = MakeObjectives();
+
+    Binary::Writer writer;
+    Records::EncodeObjectives(writer, objectives);
+
+    FakeInterface fake(writer.GetData());
+    std::vector<Records::Objective> read;
+
+    CHECK(Records::ReadObjectives(&fake, 2, fake.GetSize(), read));
+    CHECK(Equal(read, objectives));
+}
+
+TEST(RecordsLocationsRoundTrip)
+{
+    const std::vector<std::uint32_t> locations{ 0x00018A5D, 0xFF000801, 0x00000000 };
+
+    Binary::Writer writer;
+    Records::EncodeLocations(writer, locations);
+
+    FakeInterface fake(writer.GetData());
+    std::vector<std::uint32_t> read;
+
+    CHECK(Records::ReadLocations(&fake, 2, fake.GetSize(), read));
+    CHECK(read == locations);
+}
+
+TEST(RecordsTrackersRoundTrip)
+{
+    const auto trackers = MakeTrackers();
+
+    Binary::Writer writer;
+    Records::EncodeTrackers(writer, trackers);
+
+    FakeInterface fake(writer.GetData());
+    std::vector<Records::Tracker> read;
+
+    CHECK(Records::ReadTrackers(&fake, 2, fake.GetSize(), read));
+    CHECK(Equal(read, trackers));
+}
+
+TEST(RecordsObjectivesMigrateFromV1)
+{
+    const auto objectives = MakeObjectives();
+
+    LegacyWriter legacy;
+    legacy.Write<std::uint64_t>(objectives.size());
+    for (const auto& objective : objectives) {
+        legacy.Write(objective.quest);
+        legacy.Write(objective.location);
+        legacy.Write(objective.index);
+        legacy.WriteString(objective.text);
+    }
+
+    FakeInterface fake(legacy.data);
+    std::vector<Records::Objective> read;
+
+    CHECK(Records::ReadObjectives(&fake, 1, fake.GetSize(), read));
+    CHECK(Equal(read, objectives));
+
+    // Re-saving writes v2, which must read back to the same records.
+    Binary::Writer writer;
+    Records::EncodeObjectives(writer, read);
+
+    FakeInterface resaved(writer.GetData());
+    std::vector<Records::Objective> migrated;
+
+    CHECK(Records::ReadObjectives(&resaved, 2, resaved.GetSize(), migrated));
+    CHECK(Equal(migrated, objectives));
+}
+
+TEST(RecordsLocationsMigrateFromV1)
+{
+    const std::vector<std::uint32_t> locations{ 0x00018A5D, 0x00018A5E };
+
+    LegacyWriter legacy;
+    legacy.Write<std::uint64_t>(locations.size());
+    for (const auto location : locations) {
+        legacy.Write(location);
+    }
+
+    FakeInterface fake(legacy.data);
+    std::vector<std::uint32_t> read;
+
+    CHECK(Records::ReadLocations(&fake, 1, fake.GetSize(), read));
+    CHECK(read == locations);
+}
+
+TEST(RecordsTrackersMigrateFromV1)
+{
+    const auto trackers = MakeTrackers();
+
+    LegacyWriter legacy;
+    legacy.Write<std::uint64_t>(trackers.size());
+    for (const auto& tracker : trackers) {
+        legacy.Write(tracker.global);
+        legacy.Write(tracker.region);
+        legacy.Write<std::uint64_t>(tracker.reward.size());
+        for (const auto& [difficulty, quantity] : tracker.reward) {
+            legacy.Write(difficulty);
+            legacy.Write(quantity);
+        }
+    }
+
+    FakeInterface fake(legacy.data);
+    std::vector<Records::Tracker> read;
+
+    CHECK(Records::ReadTrackers(&fake, 1, fake.GetSize(), read));
+    CHECK(Equal(read, trackers));
+}
+
+TEST(RecordsRejectTruncatedV2)
+{
+    Binary::Writer objectives;
+    Records::EncodeObjectives(objectives, MakeObjectives());
+
+    Binary::Writer trackers;
+    Records::EncodeTrackers(trackers, MakeTrackers());
+
+    Binary::Writer locations;
+    Records::EncodeLocations(locations, { 0x00018A5D, 0x00018A5E });
+
+    for (std::size_t size = 0; size < objectives.GetData().size(); size++) {
+        FakeInterface fake(Truncate(objectives.GetData(), size));
+        std::vector<Records::Objective> read;
+
+        // The record header still claims the full length; the short read must be caught.
+        CHECK(!Records::ReadObjectives(&fake, 2, static_cast<std::uint32_t>(objectives.GetData().size()), read));
+
+        FakeInterface exact(Truncate(objectives.GetData(), size));
+        read.clear();
+        CHECK(!Records::ReadObjectives(&exact, 2, exact.GetSize(), read));
+    }
+
+    for (std::size_t size = 0; size < trackers.GetData().size(); size++) {
+        FakeInterface fake(Truncate(trackers.GetData(), size));
+        std::vector<Records::Tracker> read;
+        CHECK(!Records::ReadTrackers(&fake, 2, fake.GetSize(), read));
+    }
+
+    for (std::size_t size = 0; size < locations.GetData().size(); size++) {
+        FakeInterface fake(Truncate(locations.GetData(), size));
+        std::vector<std::uint32_t> read;
+        CHECK(!Records::ReadLocations(&fake, 2, fake.GetSize(), read));
+    }
+}
+
+TEST(RecordsRejectTruncatedV1)
+{
+    LegacyWriter legacy;
+    legacy.Write<std::uint64_t>(1);
+    legacy.Write<std::uint32_t>(0x01000800);
+    legacy.Write<std::uint32_t>(0x00018A5D);
+    legacy.Write<std::uint16_t>(10);
+    legacy.WriteString("Clear out Bleak Falls Barrow");
+
+    for (std::size_t size = 0; size < legacy.data.size(); size++) {
+        FakeInterface fake(Truncate(legacy.data, size));
+        std::vector<Records::Objective> read;
+        CHECK(!Records::ReadObjectives(&fake, 1, fake.GetSize(), read));
+    }
+
+    // A corrupt count must fail on the first missing record rather than allocate for it.
+    LegacyWriter corrupt;
+    corrupt.Write<std::uint64_t>(UINT64_MAX);
+    corrupt.Write<std::uint32_t>(0x00018A5D);
+
+    FakeInterface fake(corrupt.data);
+    std::vector<std::uint32_t> read;
+
+    CHECK(!Records::ReadLocations(&fake, 1, fake.GetSize(), read));
+    CHECK(read.size() == 1);
+}
+
+TEST(RecordsRejectTrailingBytes)
+{
+    Binary::Writer writer;
+    Records::EncodeLocations(writer, { 0x00018A5D });
+    writer.Write(std::uint8_t{ 0 });
+
+    FakeInterface fake(writer.GetData());
+    std::vector<std::uint32_t> read;
+
+    CHECK(!Records::ReadLocations(&fake, 2, fake.GetSize(), read));
+}
@@ -0,0 +1,146 @@
+#include "Replay.h"
+#include "Test.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+namespace
+{
+    // tests/Data/Session.bin, recorded against this table: Eastmarch holds two bandit camps and a
+    // draugr crypt, Falkreath one bandit camp, and only Eastmarch has a reward tracker.
+    auto MakeQuest(std::string a_name, std::string a_difficulty, std::uint32_t a_location, std::uint32_t a_region, std::uint32_t a_quest, std::string a_type) -> Entries::Quest
+    {
+        return { std::move(a_name), std::move(a_difficulty), { a_location, "Skyrim.esm" }, { a_region, "Skyrim.esm" }, { a_quest, "Bounty Quests Redone - NG.esl" }, std::move(a_type), "Skyrim.json" };
+    }
+
+    const std::vector<Entries::Quest> Quests{
+        MakeQuest("Cragslane Cavern", "Adept", 0x19159, 0x1676A, 0x86C, "Bandit"),
+        MakeQuest("Lost Knife Hideout", "Expert", 0x19267, 0x1676A, 0x86C, "Bandit"),
+        MakeQuest("Stony Creek Cave", "Apprentice", 0x80F28, 0x1676A, 0x86D, "Draugr"),
+        MakeQuest("Bloated Man's Grotto", "Novice", 0x18E3D, 0x1676F, 0x86C, "Bandit")
+    };
+
+    const std::vector<Entries::Reward> Rewards{
+        { { 0xF, "Skyrim.esm" }, { { Tables::DIFFICULTY::Novice, 100 }, { Tables::DIFFICULTY::Apprentice, 200 }, { Tables::DIFFICULTY::Adept, 300 }, { Tables::DIFFICULTY::Expert, 400 } } }
+    };
+
+    const std::vector<Entries::Tracker> Trackers{
+        { { 0x838, "Bounty Quests Redone - NG.esl" }, { 0x1676A, "Skyrim.esm" } }
+    };
+
+    constexpr std::array<double, 7> Weights{ 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+
+    auto ReadTrace() -> std::vector<std::byte>
+    {
+        // Run from the project directory, which is where xmake run puts the tests.
+        std::ifstream stream("tests/Data/Session.bin", std::ios::binary);
+        const std::vector<char> bytes{ std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>() };
+
+        std::vector<std::byte> result(bytes.size());
+        std::transform(bytes.begin(), bytes.end(), result.begin(), [](char a_byte) { return static_cast<std::byte>(a_byte); });
+        return result;
+    }
+}
+
+TEST(LoadOrderResolvesFullAndLightPlugins)
+{
+    Replay::LoadOrder loadOrder;
+
+    CHECK(loadOrder.Resolve({ 0x1676A, "Skyrim.esm" }) == 0x1676A);
+    CHECK(loadOrder.Resolve({ 0x1234, "Dragonborn.esm" }) == 0x04001234);
+    CHECK(loadOrder.Resolve({ 0x86C, "Bounty Quests Redone - NG.esl" }) == 0xFE00086C);
+    CHECK(loadOrder.Resolve({ 0x800, "Other.esl" }) == 0xFE001800);
+    CHECK(loadOrder.Resolve({ 0x800, "Other.esp" }) == 0x05000800);
+}
+
+TEST(RecordingRoundTripsTheCheckedInTrace)
+{
+    const auto data = ReadTrace();
+
+    std::vector<Recording::Record> records;
+    CHECK(Recording::Decode(data, records));
+    CHECK(records.size() == 11);
+
+    Binary::Writer writer;
+    Recording::EncodeHeader(writer);
+    for (const auto& record : records) {
+        Recording::Encode(writer, record.event, record.delta, record.values);
+    }
+    CHECK(writer.GetData() == data);
+
+    // A cut inside the last record keeps everything before it.
+    CHECK(!Recording::Decode(std::span(data).first(data.size() - 1), records));
+    CHECK(records.size() == 10);
+
+    auto corrupt = data;
+    corrupt[0] = std::byte{ 0 };
+    CHECK(!Recording::Decode(corrupt, records));
+    CHECK(records.empty());
+}
+
+TEST(ReplayReachesTheRecordedFinalState)
+{
+    std::vector<Recording::Record> records;
+    CHECK(Recording::Decode(ReadTrace(), records));
+
+    Replay::Session session(Quests, Rewards, Trackers, Replay::LoadOrder(), Weights, 1);
+    for (const auto& record : records) {
+        session.Apply(record);
+    }
+
+    const auto& counters = session.GetCounters();
+    CHECK(counters.events == 11);
+    CHECK(counters.unknownForms == 1);
+    CHECK(counters.offered == 2);
+    CHECK(counters.queued == 3);
+    CHECK(counters.started == 3);
+    CHECK(counters.completed == 2);
+    CHECK(counters.rewarded == 400 + 200);
+    CHECK(session.GetNoteCount() == 2);
+
+    // The last known location was Cragslane, whose hold offers bandits and draugr.
+    CHECK(session.GetCurrentMask() == ((1U << static_cast<std::uint32_t>(Tables::TYPE::Bandit)) | (1U << static_cast<std::uint32_t>(Tables::TYPE::Draugr))));
+
+    // Only Falkreath's quest is still running; both Eastmarch quests completed and were rewarded.
+    const auto& reservations = session.GetReservations();
+    CHECK(reservations.size() == 1);
+    CHECK(!reservations.empty() && reservations[0]->formID == 0x18E3D);
+
+    const auto& objectives = session.GetObjectives();
+    CHECK(objectives.size() == 3);
+
+    const auto find = [&objectives](std::uint32_t a_location) {
+        const auto it = std::ranges::find_if(objectives, [a_location](const auto& a_objective) { return a_objective->location->formID == a_location; });
+        return it != objectives.end() ? *it : nullptr;
+    };
+
+    const auto lostKnife = find(0x19267);
+    const auto grotto = find(0x18E3D);
+    const auto stonyCreek = find(0x80F28);
+    CHECK(lostKnife && lostKnife->quest->formID == 0xFE00086C && lostKnife->index == 1);
+    CHECK(grotto && grotto->quest->formID == 0xFE00086C && grotto->index == 2);
+    CHECK(stonyCreek && stonyCreek->quest->formID == 0xFE00086D && stonyCreek->index == 1);
+
+    const auto& trackers = session.GetTrackers();
+    CHECK(trackers.size() == 1);
+    CHECK(!trackers.empty() && std::ranges::all_of(trackers[0]->completed, [](std::uint32_t a_count) { return a_count == 0; }));
+}
+
+TEST(ReplayIgnoresMenusThePluginDoesNotHandle)
+{
+    Replay::Session session(Quests, Rewards, Trackers, Replay::LoadOrder(), Weights, 1);
+
+    const auto menu = [](Recording::Menu a_menu, bool a_opening) {
+        return Recording::Record{ Recording::Event::MenuOpenClose, 0, { static_cast<std::uint64_t>(a_menu), a_opening } };
+    };
+
+    session.Apply(menu(Recording::Menu::BarterMenu, false));
+    session.Apply(menu(Recording::Menu::Other, false));
+    session.Apply(menu(Recording::Menu::GiftMenu, true));
+
+    const auto& counters = session.GetCounters();
+    CHECK(counters.events == 3);
+    CHECK(counters.started == 0);
+    CHECK(session.GetCurrentMask() == 0);
+}
@@ -0,0 +1,110 @@
+#include "Store.h"
+#include "Test.h"
+
+namespace
+{
+    // Stand-ins for BGSLocation / TESQuest and Serialization::Tracker with only what Store reads.
+    struct Location
+    {
+        Location* parentLoc;
+    };
+
+    struct Quest
+    {};
+
+    struct Tracker
+    {
+        int global;
+        Location* region;
+    };
+}
+
+TEST(StoreReservationsKeepInsertionOrder)
+{
+    Location first{ nullptr };
+    Location second{ nullptr };
+    Location third{ nullptr };
+
+    Store::Reservations<Location> reservations;
+
+    CHECK(reservations.Insert(&first));
+    CHECK(reservations.Insert(&second));
+    CHECK(reservations.Insert(&third));
+    CHECK(!reservations.Insert(&second));
+    CHECK(reservations.GetLocations().size() == 3);
+
+    CHECK(reservations.Erase(&second));
+    CHECK(!reservations.Erase(&second));
+    CHECK(!reservations.Contains(&second));
+    CHECK(reservations.Contains(&third));
+    CHECK((reservations.GetLocations() == std::vector<Location*>{ &first, &third }));
+
+    reservations.Clear();
+    CHECK(reservations.GetLocations().empty());
+    CHECK(!reservations.Contains(&first));
+}
+
+TEST(StoreObjectivesReindexOnUpdate)
+{
+    Quest quest;
+    Location cave{ nullptr };
+    Location fort{ nullptr };
+
+    Store::Objectives<Quest, Location> objectives;
+    objectives.Store(&quest, &cave, 10, "Cave");
+    objectives.Store(&quest, &fort, 20, "Fort");
+
+    CHECK(objectives.Contains(&quest, &cave));
+    CHECK(objectives.Find(&quest, 10)->text == "Cave");
+    CHECK(objectives.Find(&quest, 30) == nullptr);
+
+    // Moving the cave objective to a new index drops its old index entry but keeps one record.
+    objectives.Store(&quest, &cave, 30, "Cave again");
+
+    CHECK(objectives.GetObjectives().size() == 2);
+    CHECK(objectives.Find(&quest, 10) == nullptr);
+    CHECK(objectives.Find(&quest, 30)->text == "Cave again");
+    CHECK(objectives.Find(&quest, 20)->location == &fort);
+
+    // Taking over an index held by another location must not erase the new owner later.
+    objectives.Store(&quest, &fort, 30, "Fort again");
+    objectives.Store(&quest, &cave, 40, "Cave last");
+
+    CHECK(objectives.Find(&quest, 30)->location == &fort);
+    CHECK(objectives.Find(&quest, 40)->location == &cave);
+
+    objectives.Clear();
+    CHECK(objectives.GetObjectives().empty());
+    CHECK(!objectives.Contains(&quest, &cave));
+}
+
+TEST(StoreTrackersFindEnclosingRegion)
+{
+    Location hold{ nullptr };
+    Location city{ &hold };
+    Location house{ &city };
+    Location elsewhere{ nullptr };
+
+    Store::Trackers<Tracker> trackers;
+    trackers.Add(std::make_shared<Tracker>(1, &hold));
+
+    CHECK(trackers.Find(&hold)->global == 1);
+    CHECK(trackers.Find(&city) == nullptr);
+    CHECK(trackers.FindRegion(&house) == &hold);
+    CHECK(trackers.FindRegion(&elsewhere) == nullptr);
+
+    // Adding a tracker drops the cached ancestry so the nearer region wins.
+    trackers.Add(std::make_shared<Tracker>(2, &city));
+
+    CHECK(trackers.FindRegion(&house) == &city);
+    CHECK(trackers.FindRegion(&hold) == &hold);
+    CHECK(trackers.GetTrackers().size() == 2);
+}
+
+TEST(StoreRewardQuantity)
+{
+    const std::array<std::uint32_t, 7> amount{ 0, 10, 20, 30, 40, 50, 100 };
+
+    CHECK(Store::GetRewardQuantity(amount, { 0, 0, 0, 0, 0, 0, 0 }) == 0);
+    CHECK(Store::GetRewardQuantity(amount, { 5, 1, 0, 2, 0, 0, 1 }) == 170);
+}
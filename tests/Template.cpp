@@ -0,0 +1,95 @@
+#include "Template.h"
+#include "Test.h"
+
+#include <array>
+
+namespace
+{
+    constexpr std::array<Template::Reward, 1> Gold{ { { 350, "Gold" } } };
+    constexpr Template::Arguments Arguments{ "Adept", 7, "Bleak Falls Barrow", "Falkreath Hold", Gold };
+
+    auto Render(std::string_view a_text, std::vector<std::string>& a_unknown) -> std::string
+    {
+        std::string buffer;
+        Template::Render(buffer, Template::Compile(a_text, a_unknown), Arguments);
+        return buffer;
+    }
+
+    auto Render(std::string_view a_text) -> std::string
+    {
+        std::vector<std::string> unknown;
+        return Render(a_text, unknown);
+    }
+}
+
+TEST(TemplateRendersEveryPlaceholder)
+{
+    CHECK(Render("%d: clear out %l in %r (%i) for %a") == "Adept: clear out Bleak Falls Barrow in Falkreath Hold (07) for 350 Gold");
+    CHECK(Render("%l") == "Bleak Falls Barrow");
+    CHECK(Render("") == "");
+}
+
+TEST(TemplatePadsIndexAndFormatsLargeRewards)
+{
+    std::vector<std::string> unknown;
+    std::string buffer;
+    const auto tokens = Template::Compile("%i/%a", unknown);
+
+    const std::array<Template::Reward, 1> large{ { { 4294967295U, "" } } };
+    Template::Render(buffer, tokens, { "", 123, "", "", large });
+    CHECK(buffer == "123/4294967295");
+
+    Template::Render(buffer, tokens, { "", 0, "", "", {} });
+    CHECK(buffer == "00/");
+}
+
+TEST(TemplateListsEachRewardForm)
+{
+    std::vector<std::string> unknown;
+    std::string buffer;
+    const auto tokens = Template::Compile("Reward: %a", unknown);
+
+    // Different forms are listed separately, never summed into one number.
+    const std::array<Template::Reward, 3> rewards{ { { 500, "Gold" }, { 0, "Lockpick" }, { 3, "Potion of Healing" } } };
+    Template::Render(buffer, tokens, { "", 0, "", "", rewards });
+    CHECK(buffer == "Reward: 500 Gold, 3 Potion of Healing");
+
+    const std::array<Template::Reward, 2> none{ { { 0, "Gold" }, { 0, "Potion of Healing" } } };
+    Template::Render(buffer, tokens, { "", 0, "", "", none });
+    CHECK(buffer == "Reward: ");
+}
+
+TEST(TemplateKeepsEscapedPercent)
+{
+    CHECK(Render("100%% of %l") == "100% of Bleak Falls Barrow");
+    CHECK(Render("%%l") == "%l");
+    CHECK(Render("%%%%") == "%%");
+}
+
+TEST(TemplateKeepsUnknownPlaceholders)
+{
+    std::vector<std::string> unknown;
+
+    CHECK(Render("%x marks %l, %q too", unknown) == "%x marks Bleak Falls Barrow, %q too");
+    CHECK((unknown == std::vector<std::string>{ "%x", "%q" }));
+}
+
+TEST(TemplateKeepsTrailingPercent)
+{
+    std::vector<std::string> unknown;
+
+    CHECK(Render("%l at 50%", unknown) == "Bleak Falls Barrow at 50%");
+    CHECK(Render("%", unknown) == "%");
+    CHECK(unknown.empty());
+}
+
+TEST(TemplateMergesAdjacentLiterals)
+{
+    std::vector<std::string> unknown;
+    const auto tokens = Template::Compile("a%%b%zc%l", unknown);
+
+    CHECK(tokens.size() == 2);
+    CHECK(tokens.front().kind == Template::Kind::Literal && tokens.front().text == "a%b%zc");
+    CHECK(Template::Contains(tokens, Template::Kind::Location));
+    CHECK(!Template::Contains(tokens, Template::Kind::Reward));
+}
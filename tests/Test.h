@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdio>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+// Minimal host-side test registry. Each TEST registers itself at static initialisation and
+// CHECK records a failure without aborting so one run reports every broken expectation.
+namespace Test
+{
+    struct Case
+    {
+        std::string_view name;
+        std::function<void()> body;
+    };
+
+    inline auto GetCases() -> std::vector<Case>&
+    {
+        static std::vector<Case> cases;
+        return cases;
+    }
+
+    inline auto GetFailures() -> std::size_t&
+    {
+        static std::size_t failures{ 0 };
+        return failures;
+    }
+
+    struct Registrar
+    {
+        Registrar(std::string_view a_name, std::function<void()> a_body) { GetCases().push_back({ a_name, std::move(a_body) }); }
+    };
+
+    inline void Fail(const char* a_expression, const char* a_file, int a_line)
+    {
+        std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", a_file, a_line, a_expression);
+        GetFailures()++;
+    }
+}
+
+#define TEST_CONCAT_IMPL(a, b) a##b
+#define TEST_CONCAT(a, b) TEST_CONCAT_IMPL(a, b)
+
+#define TEST(name)                                                                                   \
+    static void TEST_CONCAT(Test_, name)();                                                          \
+    static const Test::Registrar TEST_CONCAT(Registrar_, name){ #name, &TEST_CONCAT(Test_, name) }; \
+    static void TEST_CONCAT(Test_, name)()
+
+#define CHECK(expression)                                 \
+    do {                                                  \
+        if (!(expression)) {                              \
+            Test::Fail(#expression, __FILE__, __LINE__); \
+        }                                                 \
+    } while (false)
@@ -11,12 +11,26 @@ set_warnings("allextra")
 
 set_policy("package.requires_lock", true)
 
-add_rules("mode.debug", "mode.releasedbg")
+rule("mode.profile")
+    on_config(function(target)
+        if is_mode("profile") then
+            target:set("symbols", "debug")
+            target:set("optimize", "fastest")
+            target:add("defines", "NDEBUG", "BQRNG_PROFILE")
+        end
+    end)
+rule_end()
+
+add_rules("mode.debug", "mode.releasedbg", "mode.profile")
 add_rules("plugin.vsxmake.autoupdate")
 
+if is_mode("debug") then
+    add_defines("BQRNG_TRACE")
+end
+
 set_config("skyrim_vr", false)
 
-add_requires("jsoncons")
+add_requires("jsoncons", "spdlog")
 
 target("Bounty Quests Redone - NG")
 	add_deps("commonlibsse-ng")
@@ -50,3 +64,50 @@ target("Bounty Quests Redone - NG")
             copy(os.getenv("XSE_TES5_GAME_PATH"), "Data")
         end
     end)
+
+-- Host-side checks for the platform-neutral headers: xmake build tests && xmake run tests
+target("tests")
+    set_kind("binary")
+    set_default(false)
+
+    add_files("tests/**.cpp")
+    add_headerfiles("tests/**.h")
+    add_includedirs("include", "tests")
+
+    -- The replay tests read tests/Data relative to the project.
+    set_rundir("$(projectdir)")
+
+    if is_plat("linux", "macosx") then
+        add_syslinks("pthread")
+    end
+
+-- Host-side measurements for the same headers, written as JSON: xmake f -m releasedbg && xmake build bench && xmake run bench > bench.json
+target("bench")
+    set_kind("binary")
+    set_default(false)
+
+    add_packages("jsoncons", "spdlog")
+
+    add_files("bench/**.cpp")
+    add_headerfiles("bench/**.h")
+    add_includedirs("include", "bench")
+
+    if is_plat("linux", "macosx") then
+        add_syslinks("pthread")
+    end
+
+-- Replays a recorded event trace through the same headers against the shipped config: xmake build replay && xmake run replay <trace> > replay.json
+target("replay")
+    set_kind("binary")
+    set_default(false)
+
+    add_packages("jsoncons")
+
+    add_files("replay/**.cpp")
+    add_includedirs("include")
+
+    set_rundir("$(projectdir)")
+
+    if is_plat("linux", "macosx") then
+        add_syslinks("pthread")
+    end